@@ -1,133 +1,120 @@
 #include "array.hpp"
-#include <iostream>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 using namespace std;
 
-// Конструктор
-Mass::Mass() : data(nullptr), size(0), capacity(0) {}
+// Строковая инстанциация собирается один раз здесь
+template class BasicMass<string>;
 
-// Деструктор
-Mass::~Mass() { delete[] data; }
-
-// Проверка на пустоту
-bool Mass::is_empty() const { return size == 0; }
-
-// Предварительное выделение памяти
-void Mass::reserve(int new_capacity) {
-  if (new_capacity <= capacity)
-    return;
-  string *new_data = new string[new_capacity];
-  for (int i = 0; i < size; ++i) {
-    new_data[i] = data[i];
-  }
-  delete[] data;
-  data = new_data;
-  capacity = new_capacity;
+// Первые (до 4) байт строки, дополненные нулями
+uint32_t mass_head_of(const char *s, size_t len) {
+  uint32_t head = 0;
+  memcpy(&head, s, len < 4 ? len : 4);
+  return head;
 }
 
-// Добавление элемента в конец
-void Mass::push_back(const string &val) {
-  if (size == capacity) {
-    reserve(capacity == 0 ? 4 : capacity * 2);
-  }
-  data[size++] = val;
-}
+namespace {
 
-// Вставка элемента по индексу
-void Mass::insert_at(int index, const string &val) {
-  if (index < 0 || index > size)
-    return;
-  if (size == capacity) {
-    reserve(capacity == 0 ? 4 : capacity * 2);
-  }
-  for (int i = size; i > index; --i) {
-    data[i] = data[i - 1];
-  }
-  data[index] = val;
-  ++size;
-}
+using CandidateScan = int (*)(const int *, const uint32_t *, int, int, int,
+                              uint32_t, uint32_t, bool);
 
-// Удаление элемента по индексу
-void Mass::del_at(int index) {
-  if (index < 0 || index >= size)
-    return;
-  for (int i = index; i < size - 1; ++i) {
-    data[i] = data[i + 1];
+// Поэлементный проход: хвост векторных вариантов и запасной путь
+int scan_scalar(const int *lp, const uint32_t *hp, int i, int size, int len,
+                uint32_t head, uint32_t mask, bool exact) {
+  for (; i < size; ++i) {
+    bool ok_len = exact ? lp[i] == len : lp[i] >= len;
+    if (ok_len && (hp[i] & mask) == head)
+      return i;
   }
-  --size;
+  return size;
 }
 
-// Получение элемента по индексу
-string Mass::get_at(int index) const {
-  if (index < 0 || index >= size)
-    return "";
-  return data[index];
-}
-
-// Замена элемента по индексу
-void Mass::replace_at(int index, const string &val) {
-  if (index < 0 || index >= size)
-    return;
-  data[index] = val;
-}
-
-// Получение размера массива
-int Mass::get_size() const { return size; }
-
-// Печать всех элементов
-void Mass::print() const {
-  for (int i = 0; i < size; ++i) {
-    cout << data[i] << " ";
+#if defined(__x86_64__)
+// По 8 элементов; собирается без -mavx2 и вызывается, только если
+// процессор поддерживает AVX2
+__attribute__((target("avx2"))) int
+scan_avx2(const int *lp, const uint32_t *hp, int i, int size, int len,
+          uint32_t head, uint32_t mask, bool exact) {
+  const __m256i vlen = _mm256_set1_epi32(exact ? len : len - 1);
+  const __m256i vhead = _mm256_set1_epi32(static_cast<int>(head));
+  const __m256i vmask = _mm256_set1_epi32(static_cast<int>(mask));
+  for (; i + 8 <= size; i += 8) {
+    __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lp + i));
+    __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hp + i));
+    __m256i ok_len = exact ? _mm256_cmpeq_epi32(l, vlen)
+                           : _mm256_cmpgt_epi32(l, vlen);
+    __m256i ok_head = _mm256_cmpeq_epi32(_mm256_and_si256(h, vmask), vhead);
+    int bits = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_and_si256(ok_len, ok_head)));
+    if (bits)
+      return i + __builtin_ctz(bits);
   }
-  cout << endl;
+  return scan_scalar(lp, hp, i, size, len, head, mask, exact);
 }
 
-// Считывание элементов с консоли
-void Mass::read() {
-  int n;
-  cout << "Введите количество элементов: ";
-  cin >> n;
-  cin.ignore();
-
-  for (int i = 0; i < n; ++i) {
-    string val;
-    cout << "Элемент " << i << ": ";
-    getline(cin, val);
-    push_back(val);
+// По 4 элемента; SSE2 входит в базовый набор x86-64
+int scan_sse2(const int *lp, const uint32_t *hp, int i, int size, int len,
+              uint32_t head, uint32_t mask, bool exact) {
+  const __m128i vlen = _mm_set1_epi32(exact ? len : len - 1);
+  const __m128i vhead = _mm_set1_epi32(static_cast<int>(head));
+  const __m128i vmask = _mm_set1_epi32(static_cast<int>(mask));
+  for (; i + 4 <= size; i += 4) {
+    __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lp + i));
+    __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hp + i));
+    __m128i ok_len = exact ? _mm_cmpeq_epi32(l, vlen) : _mm_cmpgt_epi32(l, vlen);
+    __m128i ok_head = _mm_cmpeq_epi32(_mm_and_si128(h, vmask), vhead);
+    int bits = _mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(ok_len, ok_head)));
+    if (bits)
+      return i + __builtin_ctz(bits);
   }
+  return scan_scalar(lp, hp, i, size, len, head, mask, exact);
 }
-
-// Бинарная сериализация
-void Mass::serialize(std::ostream &out) const {
-  out.write(reinterpret_cast<const char *>(&size), sizeof(int));
-  for (int i = 0; i < size; ++i) {
-    int len = data[i].length();
-    out.write(reinterpret_cast<const char *>(&len), sizeof(int));
-    out.write(data[i].c_str(), len);
+#elif defined(__ARM_NEON)
+// По 4 элемента; NEON входит в базовый набор AArch64
+int scan_neon(const int *lp, const uint32_t *hp, int i, int size, int len,
+              uint32_t head, uint32_t mask, bool exact) {
+  const int32x4_t vlen = vdupq_n_s32(exact ? len : len - 1);
+  const uint32x4_t vhead = vdupq_n_u32(head);
+  const uint32x4_t vmask = vdupq_n_u32(mask);
+  for (; i + 4 <= size; i += 4) {
+    int32x4_t l = vld1q_s32(lp + i);
+    uint32x4_t h = vld1q_u32(hp + i);
+    uint32x4_t ok_len = exact ? vceqq_s32(l, vlen) : vcgtq_s32(l, vlen);
+    uint32x4_t ok_head = vceqq_u32(vandq_u32(h, vmask), vhead);
+    // Сужение до 16 бит на элемент: вся маска — одно 64-битное слово
+    uint64_t bits = vget_lane_u64(
+        vreinterpret_u64_u16(vmovn_u32(vandq_u32(ok_len, ok_head))), 0);
+    if (bits)
+      return i + __builtin_ctzll(bits) / 16;
   }
+  return scan_scalar(lp, hp, i, size, len, head, mask, exact);
+}
+#endif
+
+// Вариант под процессор, на котором запущена программа
+CandidateScan pick_scan() {
+#if defined(__x86_64__)
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") ? scan_avx2 : scan_sse2;
+#elif defined(__ARM_NEON)
+  return scan_neon;
+#else
+  return scan_scalar;
+#endif
 }
 
-// Бинарная десериализация
-void Mass::deserialize(std::istream &in) {
-  int new_size = 0;
-  in.read(reinterpret_cast<char *>(&new_size), sizeof(int));
-
-  // Очищаем текущие данные
-  delete[] data;
-  data = nullptr;
-  size = 0;
-  capacity = 0;
-
-  // Загружаем элементы
-  for (int i = 0; i < new_size; ++i) {
-    int len = 0;
-    in.read(reinterpret_cast<char *>(&len), sizeof(int));
-
-    char *buffer = new char[len + 1];
-    in.read(buffer, len);
-    buffer[len] = '\0';
+} // namespace
 
-    string val(buffer);
-    delete[] buffer;
-    push_back(val);
-  }
-}
\ No newline at end of file
+// Отсев кандидатов: exact — длина равна len, иначе длина >= len;
+// первые байты сравниваются под маской
+int mass_next_candidate(const int *lp, const uint32_t *hp, int from, int size,
+                        int len, uint32_t head, uint32_t mask, bool exact) {
+  static const CandidateScan scan = pick_scan();
+  return scan(lp, hp, from, size, len, head, mask, exact);
+}
@@ -1,30 +1,973 @@
 #pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
 #include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
 #include <ostream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
-class Mass {
+// Метка в конце индексированного снимка (см. serialize_indexed)
+inline constexpr char MASS_INDEX_MAGIC[8] = {'M', 'A', 'S', 'S',
+                                             'I', 'D', 'X', '1'};
+
+// Отсев кандидатов для строкового поиска: следующий индекс >= from, у
+// которого длина равна len (exact) или не меньше len, а первые байты под
+// маской совпадают с head. Вариант в array.cpp выбирается при первом
+// вызове: AVX2 или SSE2 на x86-64 по возможностям процессора, без флагов
+// сборки; NEON на AArch64; иначе поэлементный проход.
+int mass_next_candidate(const int *lens, const std::uint32_t *heads, int from,
+                        int size, int len, std::uint32_t head,
+                        std::uint32_t mask, bool exact);
+// Первые (до 4) байт строки, дополненные нулями
+std::uint32_t mass_head_of(const char *s, std::size_t len);
+
+// Динамический массив элементов T.
+// Для тривиально копируемых T перенос, вставка, удаление и сериализация
+// работают через memmove/memcpy и одну запись/чтение всего буфера.
+// Память берётся у Alloc (подходит и std::pmr::polymorphic_allocator),
+// коэффициент роста и порог автоматического сжатия настраиваются.
+template <typename T, typename Alloc = std::allocator<T>> class BasicMass {
 private:
-  std::string *data;
+  static constexpr bool trivial = std::is_trivially_copyable_v<T>;
+  static constexpr bool is_string = std::is_same_v<T, std::string>;
+  // Ниже этого размера потоки не окупаются
+  static constexpr int PARALLEL_SORT_MIN = 1 << 14;
+  static constexpr int MIN_CAPACITY = 4;
+  // deserialize: сколько элементов (и байт строки) читается за раз, когда
+  // длину потока узнать нельзя
+  static constexpr int READ_CHUNK = 1 << 16;
+
+  using traits = std::allocator_traits<Alloc>;
+  static_assert(std::is_same_v<typename traits::value_type, T>,
+                "Alloc::value_type должен совпадать с T");
+
+  // Сырая память: слоты [0, size) сконструированы, [size, capacity) — нет
+  T *elems;
   int size;
   int capacity;
+  Alloc alloc;
+  double growth_factor;    // во сколько раз растёт буфер (> 1)
+  double shrink_threshold; // сжатие при size < capacity * порог; 0 — выкл.
+
+  // Считается в long long; needed сверх INT_MAX — std::length_error
+  int next_capacity(long long needed) const;
+  void reallocate(int new_capacity);
+  void grow(); // расширение буфера при заполнении
+  void shrink_if_sparse(); // автоматическое сжатие после удаления
+  void clear();
+  void relocate(T *src, int count, T *dst);
+  // Сдвиг хвоста за один проход: слоты [index, index + count) остаются
+  // несконструированными
+  void open_gap(int index, int count);
+  void close_gap(int from, int to);
+  // Байт до конца потока; -1, если поток не позиционируется
+  static long long stream_remaining(std::istream &in);
+  template <typename... Args> void construct_back(Args &&...args);
+  // Для parallel_sort: сколько первых элементов a попадает в первые k
+  // элементов устойчивого слияния a и b; и один уровень слияний
+  static int co_rank(int k, const T *a, int n, const T *b, int m);
+  void merge_pass(T *src, T *dst, const std::vector<int> &bounds, int threads);
+
+  // Только для строк: параллельные массивы длины и первых 4 байт каждого
+  // элемента. Их правят сами мутаторы, поэтому константные find* только
+  // читают их и безопасны при одновременном вызове из нескольких потоков.
+  // Запись через ссылку или итератор, выданные неконстантными operator[],
+  // data(), begin()/end() и emplace_back, отследить нельзя: после их
+  // выдачи массив «раскрыт», массивы сбрасываются, и find* ищут полным
+  // проходом, пока rebuild_search_index() не построит их заново.
+  std::vector<int> lens;
+  std::vector<std::uint32_t> heads;
+  bool exposed;
+
+  void expose() {
+    exposed = true;
+    lens.clear();
+    heads.clear();
+  }
+  void build_index();
+  void index_insert(int index, int count); // записи для [index, index + count)
+  void index_erase(int from, int to);
 
 public:
-  Mass();
-  ~Mass();
+  // Итераторы — указатели на непрерывный буфер (random access)
+  using value_type = T;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  explicit BasicMass(const Alloc &alloc = Alloc());
+  ~BasicMass();
+
+  BasicMass(const BasicMass &) = delete;
+  BasicMass &operator=(const BasicMass &) = delete;
 
   bool is_empty() const;
   void reserve(int new_capacity);
-  void push_back(const std::string &val);
-  void insert_at(int index, const std::string &val);
+  void shrink_to_fit();
+  int get_capacity() const { return capacity; }
+  Alloc get_allocator() const { return alloc; }
+  // Неверные значения (factor <= 1, ratio вне [0, 1)) игнорируются
+  void set_growth_factor(double factor);
+  void set_shrink_threshold(double ratio);
+  void push_back(const T &val);
+  void push_back(T &&val);
+  template <typename... Args> T &emplace_back(Args &&...args); // раскрывает
+  void insert_at(int index, const T &val);
   void del_at(int index);
-  std::string get_at(int index) const;
-  void replace_at(int index, const std::string &val);
+  // Пакетные операции: одно резервирование и один сдвиг хвоста на пакет.
+  // Диапазон [first, last) не должен указывать внутрь этого же массива.
+  template <typename It> void insert_range(int index, It first, It last);
+  void erase_range(int from, int to); // удаляет [from, to)
+  void append(const BasicMass &other);
+  T get_at(int index) const; // T() при неверном индексе
+  // Доступ без копирования; operator[] не проверяет индекс. Неконстантные
+  // operator[], data() и begin()/end() раскрывают массив (см. find)
+  T &operator[](int index) {
+    expose();
+    return elems[index];
+  }
+  const T &operator[](int index) const { return elems[index]; }
+  std::string_view view_at(int index) const; // только для строк
+  void replace_at(int index, const T &val);
   int get_size() const;
+
+  T *data() {
+    expose();
+    return elems;
+  }
+  const T *data() const { return elems; }
+  // Для чтения без раскрытия — cbegin()/cend() или std::as_const
+  iterator begin() {
+    expose();
+    return elems;
+  }
+  iterator end() {
+    expose();
+    return elems + size;
+  }
+  const_iterator begin() const { return elems; }
+  const_iterator end() const { return elems + size; }
+  const_iterator cbegin() const { return elems; }
+  const_iterator cend() const { return elems + size; }
+
+  // Упорядочивание на месте: элементы только перемещаются, не копируются
+  void sort();
+  void stable_sort();
+  // threads == 0 — по числу аппаратных потоков. Не устойчива; на время
+  // слияний берёт временный буфер на size элементов
+  void parallel_sort(int threads = 0);
+  int lower_bound(const T &key) const; // индекс первого >= key
+  bool binary_search(const T &key) const;
+
+  // Поиск; для строк — с векторным отсевом по длине и первым байтам.
+  // Отсев работает, пока массив не раскрыт неконстантным operator[],
+  // data(), begin()/end() или emplace_back; раскрытый массив ищется
+  // полным проходом, пока не вызван rebuild_search_index(). Для чтения
+  // без раскрытия — константный доступ, view_at, cbegin()/cend().
+  int find(const T &key) const; // -1, если не найден
+  int count(const T &key) const;
+  std::vector<int> find_all(const T &key) const;
+  std::vector<int> find_prefix(const std::string &prefix) const; // для строк
+  bool is_search_indexed() const { return is_string && !exposed; }
+  // Вернуть отсев после раскрытия за O(n): вызывающий обещает, что
+  // выданные ссылки и итераторы больше не используются для записи
+  void rebuild_search_index();
+
   void print() const;
   void read(); // считывание с консоли
 
-  // Бинарная сериализация и десериализация
+  // Бинарная сериализация и десериализация: строки — с префиксом длины,
+  // тривиально копируемые T — размер и весь буфер одним блоком.
+  // deserialize не доверяет размерам из потока: память берётся не больше,
+  // чем могут занять оставшиеся байты, а у непозиционируемого потока —
+  // по мере чтения; на первой битой или оборванной записи чтение
+  // останавливается, прочитанное остаётся
   void serialize(std::ostream &out) const;
   void deserialize(std::istream &in);
-};
\ No newline at end of file
+  // Только для строк: тот же формат плюс таблица смещений в конце —
+  // для MassView. deserialize читает такой снимок как обычный.
+  void serialize_indexed(std::ostream &out) const;
+};
+
+// Массив строк — основная инстанциация
+using Mass = BasicMass<std::string>;
+extern template class BasicMass<std::string>;
+
+// Конструктор
+template <typename T, typename Alloc>
+BasicMass<T, Alloc>::BasicMass(const Alloc &alloc)
+    : elems(nullptr), size(0), capacity(0), alloc(alloc), growth_factor(2.0),
+      shrink_threshold(0.0), exposed(false) {}
+
+// Деструктор
+template <typename T, typename Alloc>
+BasicMass<T, Alloc>::~BasicMass() { clear(); }
+
+// Разрушение элементов и освобождение буфера
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::clear() {
+  if constexpr (!trivial) {
+    for (int i = 0; i < size; ++i) {
+      traits::destroy(alloc, elems + i);
+    }
+  }
+  if (elems)
+    traits::deallocate(alloc, elems, capacity);
+  elems = nullptr;
+  size = 0;
+  capacity = 0;
+  lens.clear();
+  heads.clear();
+  exposed = false; // старые ссылки указывают в освобождённый буфер
+}
+
+// Перенос count элементов из src в dst (области могут перекрываться):
+// src после переноса считается несконструированным
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::relocate(T *src, int count, T *dst) {
+  if (count <= 0 || src == dst)
+    return;
+  if constexpr (trivial) {
+    std::memmove(static_cast<void *>(dst), static_cast<const void *>(src),
+                 sizeof(T) * count);
+  } else if (dst < src) {
+    for (int i = 0; i < count; ++i) {
+      traits::construct(alloc, dst + i, std::move(src[i]));
+      traits::destroy(alloc, src + i);
+    }
+  } else {
+    for (int i = count - 1; i >= 0; --i) {
+      traits::construct(alloc, dst + i, std::move(src[i]));
+      traits::destroy(alloc, src + i);
+    }
+  }
+}
+
+// Проверка на пустоту
+template <typename T, typename Alloc>
+bool BasicMass<T, Alloc>::is_empty() const { return size == 0; }
+
+// Ёмкость после роста, достаточная для needed элементов
+template <typename T, typename Alloc>
+int BasicMass<T, Alloc>::next_capacity(long long needed) const {
+  constexpr int limit = std::numeric_limits<int>::max();
+  if (needed > limit)
+    throw std::length_error("BasicMass: число элементов не помещается в int");
+  // Произведение в double, пока не обрезано до limit
+  double scaled = capacity * growth_factor;
+  long long grown = capacity == 0 ? MIN_CAPACITY
+                    : scaled >= limit ? limit
+                                      : static_cast<long long>(scaled);
+  if (grown <= capacity)
+    grown = capacity < limit ? capacity + 1 : limit;
+  return static_cast<int>(grown < needed ? needed : grown);
+}
+
+// Перенос элементов в буфер new_capacity (>= size); 0 — освободить буфер
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::reallocate(int new_capacity) {
+  T *new_data =
+      new_capacity > 0 ? traits::allocate(alloc, new_capacity) : nullptr;
+  relocate(elems, size, new_data);
+  if (elems)
+    traits::deallocate(alloc, elems, capacity);
+  elems = new_data;
+  capacity = new_capacity;
+}
+
+// Предварительное выделение памяти (слоты не конструируются,
+// существующие элементы переносятся)
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::reserve(int new_capacity) {
+  if (new_capacity <= capacity)
+    return;
+  reallocate(new_capacity);
+}
+
+// Освобождение неиспользуемой ёмкости
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::shrink_to_fit() {
+  if (capacity > size)
+    reallocate(size);
+}
+
+// Рост ёмкости в growth_factor раз
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::grow() {
+  reserve(next_capacity(static_cast<long long>(size) + 1));
+}
+
+// Сжатие до size * growth_factor, если занято меньше порога
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::shrink_if_sparse() {
+  if (shrink_threshold <= 0 || capacity <= MIN_CAPACITY ||
+      size >= capacity * shrink_threshold)
+    return;
+  double scaled = size * growth_factor; // в int может не поместиться
+  int target = scaled >= capacity ? capacity : static_cast<int>(scaled);
+  if (target < MIN_CAPACITY)
+    target = MIN_CAPACITY;
+  if (target < capacity)
+    reallocate(target);
+}
+
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::set_growth_factor(double factor) {
+  if (factor > 1.0)
+    growth_factor = factor;
+}
+
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::set_shrink_threshold(double ratio) {
+  if (ratio >= 0.0 && ratio < 1.0)
+    shrink_threshold = ratio;
+}
+
+// Конструирование элемента прямо в свободном слоте
+template <typename T, typename Alloc>
+template <typename... Args>
+void BasicMass<T, Alloc>::construct_back(Args &&...args) {
+  if (size == capacity) {
+    // аргументы могут ссылаться на элементы массива — собираем элемент до
+    // переезда буфера
+    T tmp(std::forward<Args>(args)...);
+    grow();
+    traits::construct(alloc, elems + size, std::move(tmp));
+  } else {
+    traits::construct(alloc, elems + size, std::forward<Args>(args)...);
+  }
+  ++size;
+}
+
+// Конструирование элемента в конце; возвращённая ссылка раскрывает массив
+template <typename T, typename Alloc>
+template <typename... Args>
+T &BasicMass<T, Alloc>::emplace_back(Args &&...args) {
+  construct_back(std::forward<Args>(args)...);
+  expose();
+  return elems[size - 1];
+}
+
+// Добавление элемента в конец
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::push_back(const T &val) {
+  construct_back(val);
+  index_insert(size - 1, 1);
+}
+
+// Добавление элемента в конец перемещением
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::push_back(T &&val) {
+  construct_back(std::move(val));
+  index_insert(size - 1, 1);
+}
+
+// Освобождение места под count элементов начиная с index.
+// Каждый элемент хвоста переносится ровно один раз: либо в новый буфер,
+// либо на count позиций вправо в текущем.
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::open_gap(int index, int count) {
+  long long needed = static_cast<long long>(size) + count;
+  if (needed > capacity) {
+    int new_capacity = next_capacity(needed);
+    T *new_data = traits::allocate(alloc, new_capacity);
+    relocate(elems, index, new_data);
+    relocate(elems + index, size - index, new_data + index + count);
+    if (elems)
+      traits::deallocate(alloc, elems, capacity);
+    elems = new_data;
+    capacity = new_capacity;
+    return;
+  }
+  relocate(elems + index, size - index, elems + index + count);
+}
+
+// Удаление слотов [from, to) и перенос хвоста влево за один проход
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::close_gap(int from, int to) {
+  index_erase(from, to);
+  if constexpr (!trivial) {
+    for (int i = from; i < to; ++i) {
+      traits::destroy(alloc, elems + i);
+    }
+  }
+  relocate(elems + to, size - to, elems + from);
+  size -= to - from;
+  shrink_if_sparse();
+}
+
+// Вставка элемента по индексу
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::insert_at(int index, const T &val) {
+  if (index < 0 || index > size)
+    return;
+  T tmp(val); // val может указывать внутрь массива
+  open_gap(index, 1);
+  traits::construct(alloc, elems + index, std::move(tmp));
+  ++size;
+  index_insert(index, 1);
+}
+
+// Удаление элемента по индексу
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::del_at(int index) {
+  if (index < 0 || index >= size)
+    return;
+  close_gap(index, index + 1);
+}
+
+// Вставка диапазона по индексу
+template <typename T, typename Alloc>
+template <typename It>
+void BasicMass<T, Alloc>::insert_range(int index, It first, It last) {
+  static_assert(std::is_base_of_v<std::forward_iterator_tag,
+                                  typename std::iterator_traits<It>::iterator_category>,
+                "insert_range проходит диапазон дважды: нужны прямые итераторы");
+  if (index < 0 || index > size)
+    return;
+  auto distance = std::distance(first, last);
+  if (distance <= 0)
+    return;
+  if (distance > std::numeric_limits<int>::max() - size)
+    throw std::length_error("BasicMass: число элементов не помещается в int");
+  int count = static_cast<int>(distance);
+  open_gap(index, count);
+  int built = 0;
+  try {
+    for (; first != last; ++first, ++built) {
+      traits::construct(alloc, elems + index + built, *first);
+    }
+  } catch (...) {
+    // Откат: построенное разрушается, хвост возвращается на место
+    for (int i = 0; i < built; ++i) {
+      traits::destroy(alloc, elems + index + i);
+    }
+    relocate(elems + index + count, size - index, elems + index);
+    throw;
+  }
+  size += count;
+  index_insert(index, count);
+}
+
+// Удаление диапазона [from, to)
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::erase_range(int from, int to) {
+  if (from < 0 || to > size || from >= to)
+    return;
+  close_gap(from, to);
+}
+
+// Добавление всех элементов другого массива в конец
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::append(const BasicMass &other) {
+  int count = other.size; // other может совпадать с *this
+  if (count == 0)
+    return;
+  if (static_cast<long long>(size) + count > capacity)
+    reserve(next_capacity(static_cast<long long>(size) + count));
+  if constexpr (trivial) {
+    std::memcpy(static_cast<void *>(elems + size),
+                static_cast<const void *>(other.elems), sizeof(T) * count);
+  } else {
+    for (int i = 0; i < count; ++i) {
+      traits::construct(alloc, elems + size + i, other.elems[i]);
+    }
+  }
+  size += count;
+  index_insert(size - count, count);
+}
+
+// Получение элемента по индексу
+template <typename T, typename Alloc>
+T BasicMass<T, Alloc>::get_at(int index) const {
+  if (index < 0 || index >= size)
+    return T();
+  return elems[index];
+}
+
+// Просмотр строки без копирования
+template <typename T, typename Alloc>
+std::string_view BasicMass<T, Alloc>::view_at(int index) const {
+  if (index < 0 || index >= size)
+    return std::string_view();
+  return elems[index];
+}
+
+// Замена элемента по индексу
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::replace_at(int index, const T &val) {
+  if (index < 0 || index >= size)
+    return;
+  elems[index] = val;
+  if constexpr (is_string) {
+    if (!exposed) {
+      lens[index] = static_cast<int>(val.size());
+      heads[index] = mass_head_of(val.data(), val.size());
+    }
+  }
+}
+
+// Получение размера массива
+template <typename T, typename Alloc>
+int BasicMass<T, Alloc>::get_size() const { return size; }
+
+// Сортировка по возрастанию
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::sort() {
+  std::sort(elems, elems + size);
+  build_index();
+}
+
+// Устойчивая сортировка по возрастанию
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::stable_sort() {
+  std::stable_sort(elems, elems + size);
+  build_index();
+}
+
+// Многопоточная сортировка: каждый поток сортирует свой отрезок, затем
+// отрезки сливаются попарно по уровням. Выход каждого уровня делится на
+// threads равных частей, а границу части внутри пары отрезков находит
+// co_rank, так что и последнее слияние всего массива идёт во все потоки.
+// Уровни переносят элементы поочерёдно между буфером массива и временным.
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::parallel_sort(int threads) {
+  if (threads <= 0)
+    threads = static_cast<int>(std::thread::hardware_concurrency());
+  if (threads > size / (PARALLEL_SORT_MIN / 2))
+    threads = size / (PARALLEL_SORT_MIN / 2);
+  if (threads <= 1) {
+    sort();
+    return;
+  }
+
+  std::vector<int> bounds(threads + 1);
+  for (int i = 0; i <= threads; ++i) {
+    bounds[i] = static_cast<int>(static_cast<long long>(size) * i / threads);
+  }
+
+  std::vector<std::thread> workers;
+  for (int i = 0; i < threads; ++i) {
+    workers.emplace_back([this, &bounds, i] {
+      std::sort(elems + bounds[i], elems + bounds[i + 1]);
+    });
+  }
+  for (std::thread &t : workers)
+    t.join();
+
+  // Слияние соседних отрезков: bounds сжимается вдвое на каждом уровне
+  T *scratch = traits::allocate(alloc, size);
+  T *src = elems;
+  T *dst = scratch;
+  while (bounds.size() > 2) {
+    merge_pass(src, dst, bounds, threads);
+    std::swap(src, dst);
+    std::vector<int> next;
+    for (size_t i = 0; i < bounds.size(); i += 2) {
+      next.push_back(bounds[i]);
+    }
+    if (next.back() != size)
+      next.push_back(size);
+    bounds.swap(next);
+  }
+  if (src == scratch) { // нечётное число уровней — вернуть элементы на место
+    workers.clear();
+    for (int i = 0; i < threads; ++i) {
+      int from = static_cast<int>(static_cast<long long>(size) * i / threads);
+      int to = static_cast<int>(static_cast<long long>(size) * (i + 1) / threads);
+      workers.emplace_back([this, scratch, from, to] {
+        relocate(scratch + from, to - from, elems + from);
+      });
+    }
+    for (std::thread &t : workers)
+      t.join();
+  }
+  traits::deallocate(alloc, scratch, size);
+  build_index();
+}
+
+// Бинарный поиск по диагонали слияния: наименьшее i, при котором a[i]
+// уже не входит в первые k элементов (при равенстве a идёт раньше b)
+template <typename T, typename Alloc>
+int BasicMass<T, Alloc>::co_rank(int k, const T *a, int n, const T *b, int m) {
+  int lo = k > m ? k - m : 0;
+  int hi = k < n ? k : n;
+  while (lo < hi) {
+    int i = lo + (hi - lo) / 2;
+    int j = k - i;
+    if (j > 0 && !(b[j - 1] < a[i]))
+      lo = i + 1;
+    else
+      hi = i;
+  }
+  return lo;
+}
+
+// Один уровень: пары отрезков [bounds[p], bounds[p+1]) и [bounds[p+1],
+// bounds[p+2]) сливаются из src в dst (отрезок без пары просто
+// переносится). Поток t пишет позиции [size*t/threads, size*(t+1)/threads)
+// и переносит каждый элемент ровно один раз. Разрезы считаются заранее:
+// во время слияния другие потоки уже разрушают элементы src.
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::merge_pass(T *src, T *dst,
+                                     const std::vector<int> &bounds,
+                                     int threads) {
+  int pairs = static_cast<int>(bounds.size()) / 2;
+  auto pair_from = [&](int p) { return bounds[2 * p]; };
+  auto pair_mid = [&](int p) { return bounds[2 * p + 1]; };
+  auto pair_to = [&](int p) {
+    return 2 * p + 2 < static_cast<int>(bounds.size()) ? bounds[2 * p + 2]
+                                                       : bounds[2 * p + 1];
+  };
+
+  // Граница части t: пара, в которую она попала, и разрез co_rank
+  std::vector<int> edge(threads + 1), cut(threads + 1, 0);
+  for (int t = 0, p = 0; t <= threads; ++t) {
+    edge[t] = static_cast<int>(static_cast<long long>(size) * t / threads);
+    while (p + 1 < pairs && pair_to(p) <= edge[t])
+      ++p;
+    int from = pair_from(p), mid = pair_mid(p), to = pair_to(p);
+    if (edge[t] > from && edge[t] < to)
+      cut[t] = co_rank(edge[t] - from, src + from, mid - from, src + mid,
+                       to - mid);
+  }
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t] {
+      int lo = edge[t], hi = edge[t + 1];
+      for (int p = 0; p < pairs; ++p) {
+        int from = pair_from(p), mid = pair_mid(p), to = pair_to(p);
+        if (to <= lo || from >= hi)
+          continue;
+        T *a = src + from;
+        T *b = src + mid;
+        int n = mid - from;
+        int i = from >= lo ? 0 : cut[t];
+        int j = (from >= lo ? 0 : lo - from) - i;
+        int i_end = to <= hi ? n : cut[t + 1];
+        int j_end = (to <= hi ? to : hi) - from - i_end;
+        T *out = dst + from + i + j;
+        while (i < i_end && j < j_end) {
+          T *next = b[j] < a[i] ? b + j++ : a + i++;
+          traits::construct(alloc, out++, std::move(*next));
+          traits::destroy(alloc, next);
+        }
+        relocate(a + i, i_end - i, out);
+        out += i_end - i;
+        relocate(b + j, j_end - j, out);
+      }
+    });
+  }
+  for (std::thread &t : workers)
+    t.join();
+}
+
+// Бинарный поиск позиции (массив должен быть отсортирован)
+template <typename T, typename Alloc>
+int BasicMass<T, Alloc>::lower_bound(const T &key) const {
+  return static_cast<int>(std::lower_bound(begin(), end(), key) - begin());
+}
+
+// Проверка наличия ключа в отсортированном массиве
+template <typename T, typename Alloc>
+bool BasicMass<T, Alloc>::binary_search(const T &key) const {
+  return std::binary_search(begin(), end(), key);
+}
+
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::rebuild_search_index() {
+  exposed = false;
+  build_index();
+}
+
+// Построение параллельных массивов длин и первых байт заново; у
+// раскрытого массива они не ведутся
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::build_index() {
+  if constexpr (is_string) {
+    if (exposed)
+      return;
+    lens.resize(size);
+    heads.resize(size);
+    for (int i = 0; i < size; ++i) {
+      lens[i] = static_cast<int>(elems[i].size());
+      heads[i] = mass_head_of(elems[i].data(), elems[i].size());
+    }
+  }
+}
+
+// Записи для элементов [index, index + count), уже стоящих в массиве
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::index_insert(int index, int count) {
+  if constexpr (is_string) {
+    if (exposed)
+      return;
+    lens.insert(lens.begin() + index, count, 0);
+    heads.insert(heads.begin() + index, count, 0);
+    for (int i = index; i < index + count; ++i) {
+      lens[i] = static_cast<int>(elems[i].size());
+      heads[i] = mass_head_of(elems[i].data(), elems[i].size());
+    }
+  }
+}
+
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::index_erase(int from, int to) {
+  if constexpr (is_string) {
+    if (exposed)
+      return;
+    lens.erase(lens.begin() + from, lens.begin() + to);
+    heads.erase(heads.begin() + from, heads.begin() + to);
+  }
+}
+
+// Первый индекс элемента, равного key
+template <typename T, typename Alloc>
+int BasicMass<T, Alloc>::find(const T &key) const {
+  if constexpr (is_string) {
+    if (!exposed) {
+      int len = static_cast<int>(key.size());
+      std::uint32_t head = mass_head_of(key.data(), key.size());
+      for (int i = mass_next_candidate(lens.data(), heads.data(), 0, size, len,
+                                       head, 0xFFFFFFFFu, true);
+           i < size; i = mass_next_candidate(lens.data(), heads.data(), i + 1,
+                                             size, len, head, 0xFFFFFFFFu, true)) {
+        if (elems[i] == key)
+          return i;
+      }
+      return -1;
+    }
+  }
+  for (int i = 0; i < size; ++i) {
+    if (elems[i] == key)
+      return i;
+  }
+  return -1;
+}
+
+// Количество элементов, равных key
+template <typename T, typename Alloc>
+int BasicMass<T, Alloc>::count(const T &key) const {
+  int result = 0;
+  if constexpr (is_string) {
+    if (!exposed) {
+      int len = static_cast<int>(key.size());
+      std::uint32_t head = mass_head_of(key.data(), key.size());
+      for (int i = mass_next_candidate(lens.data(), heads.data(), 0, size, len,
+                                       head, 0xFFFFFFFFu, true);
+           i < size; i = mass_next_candidate(lens.data(), heads.data(), i + 1,
+                                             size, len, head, 0xFFFFFFFFu, true)) {
+        if (elems[i] == key)
+          ++result;
+      }
+      return result;
+    }
+  }
+  for (int i = 0; i < size; ++i) {
+    if (elems[i] == key)
+      ++result;
+  }
+  return result;
+}
+
+// Все индексы элементов, равных key
+template <typename T, typename Alloc>
+std::vector<int> BasicMass<T, Alloc>::find_all(const T &key) const {
+  std::vector<int> result;
+  if constexpr (is_string) {
+    if (!exposed) {
+      int len = static_cast<int>(key.size());
+      std::uint32_t head = mass_head_of(key.data(), key.size());
+      for (int i = mass_next_candidate(lens.data(), heads.data(), 0, size, len,
+                                       head, 0xFFFFFFFFu, true);
+           i < size; i = mass_next_candidate(lens.data(), heads.data(), i + 1,
+                                             size, len, head, 0xFFFFFFFFu, true)) {
+        if (elems[i] == key)
+          result.push_back(i);
+      }
+      return result;
+    }
+  }
+  for (int i = 0; i < size; ++i) {
+    if (elems[i] == key)
+      result.push_back(i);
+  }
+  return result;
+}
+
+// Все индексы строк, начинающихся с prefix
+template <typename T, typename Alloc>
+std::vector<int> BasicMass<T, Alloc>::find_prefix(const std::string &prefix) const {
+  static_assert(is_string, "find_prefix доступен только для строк");
+  std::vector<int> result;
+  if (exposed) {
+    for (int i = 0; i < size; ++i) {
+      if (elems[i].compare(0, prefix.size(), prefix) == 0)
+        result.push_back(i);
+    }
+    return result;
+  }
+  int len = static_cast<int>(prefix.size());
+  std::uint32_t head = mass_head_of(prefix.data(), prefix.size());
+  std::uint32_t mask = mass_head_of("\xff\xff\xff\xff", prefix.size());
+  for (int i = mass_next_candidate(lens.data(), heads.data(), 0, size, len,
+                                   head, mask, false);
+       i < size; i = mass_next_candidate(lens.data(), heads.data(), i + 1, size,
+                                         len, head, mask, false)) {
+    if (elems[i].compare(0, prefix.size(), prefix) == 0)
+      result.push_back(i);
+  }
+  return result;
+}
+
+// Печать всех элементов
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::print() const {
+  for (int i = 0; i < size; ++i) {
+    std::cout << elems[i] << " ";
+  }
+  std::cout << std::endl;
+}
+
+// Считывание элементов с консоли
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::read() {
+  int n;
+  std::cout << "Введите количество элементов: ";
+  std::cin >> n;
+  std::cin.ignore();
+
+  for (int i = 0; i < n; ++i) {
+    T val{};
+    std::cout << "Элемент " << i << ": ";
+    if constexpr (is_string) {
+      std::getline(std::cin, val);
+    } else {
+      std::cin >> val;
+    }
+    push_back(std::move(val));
+  }
+}
+
+// Бинарная сериализация
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::serialize(std::ostream &out) const {
+  static_assert(is_string || trivial,
+                "сериализация поддерживает строки и тривиально копируемые T");
+  out.write(reinterpret_cast<const char *>(&size), sizeof(int));
+  if constexpr (is_string) {
+    for (int i = 0; i < size; ++i) {
+      int len = elems[i].length();
+      out.write(reinterpret_cast<const char *>(&len), sizeof(int));
+      out.write(elems[i].c_str(), len);
+    }
+  } else if (size > 0) {
+    out.write(reinterpret_cast<const char *>(elems), sizeof(T) * size);
+  }
+}
+
+// Бинарная сериализация с таблицей смещений:
+// [снимок serialize][int64 смещение элемента]*size[int64 начало таблицы][метка]
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::serialize_indexed(std::ostream &out) const {
+  static_assert(is_string, "индексированный снимок доступен только для строк");
+  serialize(out);
+  std::int64_t pos = sizeof(int);
+  for (int i = 0; i < size; ++i) {
+    out.write(reinterpret_cast<const char *>(&pos), sizeof(std::int64_t));
+    pos += sizeof(int) + elems[i].length();
+  }
+  out.write(reinterpret_cast<const char *>(&pos), sizeof(std::int64_t));
+  out.write(MASS_INDEX_MAGIC, sizeof(MASS_INDEX_MAGIC));
+}
+
+// Бинарная десериализация
+template <typename T, typename Alloc>
+void BasicMass<T, Alloc>::deserialize(std::istream &in) {
+  static_assert(is_string || trivial,
+                "сериализация поддерживает строки и тривиально копируемые T");
+  int new_size = 0;
+  in.read(reinterpret_cast<char *>(&new_size), sizeof(int));
+
+  // Очищаем текущие данные
+  clear();
+  if (!in || new_size <= 0)
+    return;
+  // Запись занимает не меньше min_record байт: резерв по заголовку не
+  // больше, чем поместилось бы в остаток потока
+  constexpr long long min_record = is_string ? sizeof(int) : sizeof(T);
+  long long remaining = stream_remaining(in);
+  long long fits = remaining >= 0 ? remaining / min_record : READ_CHUNK;
+  reserve(static_cast<int>(fits < new_size ? fits : new_size));
+
+  if constexpr (is_string) {
+    // Загружаем элементы сразу в строку без промежуточного буфера;
+    // строка неизвестной длины растёт кусками по мере чтения
+    for (int i = 0; i < new_size; ++i) {
+      int len = 0;
+      in.read(reinterpret_cast<char *>(&len), sizeof(int));
+      if (!in || len < 0)
+        return;
+      if (remaining >= 0) {
+        remaining -= min_record;
+        if (len > remaining)
+          return;
+        remaining -= len;
+      }
+
+      std::string val;
+      for (int done = 0; done < len;) {
+        int part = remaining >= 0 || len - done < READ_CHUNK ? len - done
+                                                             : READ_CHUNK;
+        val.resize(done + part);
+        in.read(&val[done], part);
+        if (!in)
+          return;
+        done += part;
+      }
+      push_back(std::move(val));
+    }
+  } else {
+    // Буфер одним чтением, если остаток потока известен, иначе кусками
+    while (size < new_size) {
+      int part = new_size - size;
+      if (capacity > size)
+        part = capacity - size < part ? capacity - size : part;
+      else if (remaining >= 0) // известный остаток уже в буфере
+        return;
+      else if (part > READ_CHUNK)
+        part = READ_CHUNK;
+      if (size + part > capacity)
+        reserve(next_capacity(static_cast<long long>(size) + part));
+      in.read(reinterpret_cast<char *>(elems + size), sizeof(T) * part);
+      size += static_cast<int>(in.gcount() / sizeof(T));
+      if (!in)
+        return;
+    }
+  }
+}
+
+template <typename T, typename Alloc>
+long long BasicMass<T, Alloc>::stream_remaining(std::istream &in) {
+  std::istream::pos_type here = in.tellg();
+  if (here == std::istream::pos_type(-1))
+    return -1;
+  in.seekg(0, std::ios::end);
+  std::istream::pos_type end = in.tellg();
+  in.clear();
+  in.seekg(here);
+  if (end == std::istream::pos_type(-1) || end < here)
+    return -1;
+  return static_cast<long long>(end - here);
+}
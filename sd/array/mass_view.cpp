@@ -0,0 +1,129 @@
+#include "mass_view.hpp"
+#include "array.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+// Хвост индексированного снимка: [int64 смещение таблицы][метка]
+static const size_t TRAILER_SIZE = sizeof(int64_t) + sizeof(MASS_INDEX_MAGIC);
+
+// Конструктор
+MassView::MassView()
+    : base(nullptr), length(0), size(0), index(nullptr),
+      scan_offsets(nullptr) {}
+
+// Деструктор
+MassView::~MassView() { close(); }
+
+// Смещение префикса длины элемента i
+size_t MassView::offset_of(int i) const {
+  if (scan_offsets)
+    return scan_offsets[i];
+  int64_t off = 0;
+  memcpy(&off, index + static_cast<size_t>(i) * sizeof(int64_t),
+         sizeof(int64_t));
+  return static_cast<size_t>(off);
+}
+
+// Проход по файлу без индекса с проверкой границ
+bool MassView::build_offsets() {
+  scan_offsets = new size_t[size > 0 ? size : 1];
+  size_t pos = sizeof(int);
+  for (int i = 0; i < size; ++i) {
+    int len = 0;
+    if (pos + sizeof(int) > length)
+      return false;
+    memcpy(&len, base + pos, sizeof(int));
+    if (len < 0 || pos + sizeof(int) + len > length)
+      return false;
+    scan_offsets[i] = pos;
+    pos += sizeof(int) + len;
+  }
+  return true;
+}
+
+// Отображение файла в память
+bool MassView::open(const string &path) {
+  close();
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(int))) {
+    ::close(fd);
+    return false;
+  }
+  length = static_cast<size_t>(st.st_size);
+  void *mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // отображение остаётся действительным
+  if (mapped == MAP_FAILED) {
+    length = 0;
+    return false;
+  }
+  base = static_cast<const char *>(mapped);
+  memcpy(&size, base, sizeof(int));
+  if (size < 0) {
+    close();
+    return false;
+  }
+
+  // Индекс читается из хвоста без обхода элементов
+  if (length >= sizeof(int) + TRAILER_SIZE &&
+      memcmp(base + length - sizeof(MASS_INDEX_MAGIC), MASS_INDEX_MAGIC,
+             sizeof(MASS_INDEX_MAGIC)) == 0) {
+    int64_t table = 0;
+    memcpy(&table, base + length - TRAILER_SIZE, sizeof(int64_t));
+    size_t table_bytes = static_cast<size_t>(size) * sizeof(int64_t);
+    if (table >= static_cast<int64_t>(sizeof(int)) &&
+        static_cast<size_t>(table) + table_bytes + TRAILER_SIZE == length) {
+      index = base + table;
+      return true;
+    }
+  }
+
+  if (!build_offsets()) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+// Снятие отображения
+void MassView::close() {
+  if (base)
+    munmap(const_cast<char *>(base), length);
+  delete[] scan_offsets;
+  base = nullptr;
+  length = 0;
+  size = 0;
+  index = nullptr;
+  scan_offsets = nullptr;
+}
+
+bool MassView::is_open() const { return base != nullptr; }
+
+bool MassView::is_indexed() const { return index != nullptr; }
+
+bool MassView::is_empty() const { return size == 0; }
+
+int MassView::get_size() const { return size; }
+
+// Элемент прямо из отображения. Смещения из таблицы файла не
+// проверялись при открытии, поэтому границы сверяются здесь, за O(1)
+string_view MassView::get_at(int i) const {
+  if (i < 0 || i >= size)
+    return string_view();
+  size_t limit = index ? static_cast<size_t>(index - base) : length;
+  size_t off = offset_of(i);
+  if (off > limit || limit - off < sizeof(int))
+    return string_view();
+  int len = 0;
+  memcpy(&len, base + off, sizeof(int));
+  if (len < 0 || static_cast<size_t>(len) > limit - off - sizeof(int))
+    return string_view();
+  return string_view(base + off + sizeof(int), len);
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+// Только для чтения: отображение в память снимка, записанного
+// Mass::serialize / Mass::serialize_indexed. Элементы отдаются как
+// string_view прямо из отображения, страницы подгружаются ОС по мере
+// обращения. Для снимка с индексом открытие — O(1), без индекса
+// смещения строятся одним проходом по файлу.
+class MassView {
+private:
+  const char *base;           // начало отображения
+  std::size_t length;         // размер файла
+  int size;                   // число элементов
+  const char *index;          // таблица смещений из файла (или nullptr)
+  std::size_t *scan_offsets;  // смещения, построенные проходом по файлу
+
+  std::size_t offset_of(int i) const;
+  bool build_offsets();
+
+public:
+  class const_iterator {
+    const MassView *view;
+    int pos;
+
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string_view *;
+    using reference = std::string_view;
+
+    const_iterator(const MassView *v, int p) : view(v), pos(p) {}
+    std::string_view operator*() const { return view->get_at(pos); }
+    std::string_view operator[](difference_type n) const {
+      return view->get_at(pos + static_cast<int>(n));
+    }
+    const_iterator &operator++() { ++pos; return *this; }
+    const_iterator operator++(int) { const_iterator t = *this; ++pos; return t; }
+    const_iterator &operator--() { --pos; return *this; }
+    const_iterator operator--(int) { const_iterator t = *this; --pos; return t; }
+    const_iterator &operator+=(difference_type n) { pos += static_cast<int>(n); return *this; }
+    const_iterator &operator-=(difference_type n) { pos -= static_cast<int>(n); return *this; }
+    const_iterator operator+(difference_type n) const { return {view, pos + static_cast<int>(n)}; }
+    const_iterator operator-(difference_type n) const { return {view, pos - static_cast<int>(n)}; }
+    difference_type operator-(const const_iterator &o) const { return pos - o.pos; }
+    bool operator==(const const_iterator &o) const { return pos == o.pos; }
+    bool operator!=(const const_iterator &o) const { return pos != o.pos; }
+    bool operator<(const const_iterator &o) const { return pos < o.pos; }
+    bool operator>(const const_iterator &o) const { return pos > o.pos; }
+    bool operator<=(const const_iterator &o) const { return pos <= o.pos; }
+    bool operator>=(const const_iterator &o) const { return pos >= o.pos; }
+  };
+
+  MassView();
+  ~MassView();
+
+  MassView(const MassView &) = delete;
+  MassView &operator=(const MassView &) = delete;
+
+  bool open(const std::string &path); // false, если файл не читается
+  void close();
+  bool is_open() const;
+  bool is_indexed() const; // открыт ли снимок с таблицей смещений
+
+  bool is_empty() const;
+  int get_size() const;
+  // "" при неверном индексе или записи, выходящей за границы файла
+  std::string_view get_at(int index) const;
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size); }
+};
@@ -0,0 +1,141 @@
+#include "pool_array.hpp"
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+// Конструктор
+PoolMass::PoolMass() : garbage(0) {}
+
+// Проверка на пустоту
+bool PoolMass::is_empty() const { return entries.empty(); }
+
+// Предварительное выделение таблицы и арены
+void PoolMass::reserve(int new_capacity, size_t bytes) {
+  if (new_capacity > 0)
+    entries.reserve(new_capacity);
+  if (bytes > 0)
+    arena.reserve(bytes);
+}
+
+// Дописать символы в конец арены
+PoolMass::Entry PoolMass::store(string_view val) {
+  Entry e{arena.size(), static_cast<int>(val.size())};
+  const char *base = arena.data();
+  if (val.data() >= base && val.data() < base + arena.size()) {
+    // val указывает в саму арену — запоминаем смещение до переезда
+    size_t from = val.data() - base;
+    arena.resize(arena.size() + val.size());
+    memcpy(arena.data() + e.offset, arena.data() + from, val.size());
+  } else {
+    arena.insert(arena.end(), val.begin(), val.end());
+  }
+  return e;
+}
+
+// Добавление элемента в конец
+void PoolMass::push_back(string_view val) { entries.push_back(store(val)); }
+
+// Вставка элемента по индексу (сдвигается только таблица)
+void PoolMass::insert_at(int index, string_view val) {
+  if (index < 0 || index > get_size())
+    return;
+  Entry e = store(val);
+  entries.insert(entries.begin() + index, e);
+}
+
+// Удаление элемента по индексу
+void PoolMass::del_at(int index) {
+  if (index < 0 || index >= get_size())
+    return;
+  garbage += entries[index].length;
+  entries.erase(entries.begin() + index);
+}
+
+// Получение элемента по индексу
+string_view PoolMass::get_at(int index) const {
+  if (index < 0 || index >= get_size())
+    return string_view();
+  const Entry &e = entries[index];
+  return string_view(arena.data() + e.offset, e.length);
+}
+
+// Замена элемента по индексу: короткое значение пишется поверх старого
+void PoolMass::replace_at(int index, string_view val) {
+  if (index < 0 || index >= get_size())
+    return;
+  Entry &e = entries[index];
+  if (static_cast<int>(val.size()) <= e.length) {
+    memmove(arena.data() + e.offset, val.data(), val.size());
+    garbage += e.length - val.size();
+    e.length = static_cast<int>(val.size());
+    return;
+  }
+  garbage += e.length;
+  Entry stored = store(val);
+  entries[index] = stored;
+}
+
+// Получение размера массива
+int PoolMass::get_size() const { return static_cast<int>(entries.size()); }
+
+// Печать всех элементов
+void PoolMass::print() const {
+  for (int i = 0; i < get_size(); ++i) {
+    cout << get_at(i) << " ";
+  }
+  cout << endl;
+}
+
+// Полезные байты строк
+size_t PoolMass::bytes_used() const { return arena.size() - garbage; }
+
+// Выделенная память
+size_t PoolMass::memory_usage() const {
+  return arena.capacity() + entries.capacity() * sizeof(Entry);
+}
+
+// Переупаковка арены в порядке элементов
+void PoolMass::compact() {
+  vector<char> packed;
+  packed.reserve(bytes_used());
+  for (Entry &e : entries) {
+    size_t offset = packed.size();
+    packed.insert(packed.end(), arena.begin() + e.offset,
+                  arena.begin() + e.offset + e.length);
+    e.offset = offset;
+  }
+  arena.swap(packed);
+  garbage = 0;
+}
+
+// Бинарная сериализация
+void PoolMass::serialize(std::ostream &out) const {
+  int size = get_size();
+  out.write(reinterpret_cast<const char *>(&size), sizeof(int));
+  for (const Entry &e : entries) {
+    out.write(reinterpret_cast<const char *>(&e.length), sizeof(int));
+    out.write(arena.data() + e.offset, e.length);
+  }
+}
+
+// Бинарная десериализация: символы читаются прямо в арену
+void PoolMass::deserialize(std::istream &in) {
+  int new_size = 0;
+  in.read(reinterpret_cast<char *>(&new_size), sizeof(int));
+
+  arena.clear();
+  entries.clear();
+  garbage = 0;
+  if (new_size > 0)
+    entries.reserve(new_size);
+
+  for (int i = 0; i < new_size; ++i) {
+    int len = 0;
+    in.read(reinterpret_cast<char *>(&len), sizeof(int));
+
+    Entry e{arena.size(), len};
+    arena.resize(arena.size() + len);
+    in.read(arena.data() + e.offset, len);
+    entries.push_back(e);
+  }
+}
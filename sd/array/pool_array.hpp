@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Массив строк поверх одной непрерывной арены байтов.
+// Символы всех элементов лежат подряд в arena, а таблица entries хранит
+// смещение и длину каждого элемента — отдельной аллокации на строку нет.
+// string_view из get_at действителен до следующей модифицирующей операции.
+class PoolMass {
+private:
+  struct Entry {
+    std::size_t offset;
+    int length;
+  };
+
+  std::vector<char> arena;
+  std::vector<Entry> entries;
+  std::size_t garbage; // байты арены, на которые не ссылается ни один элемент
+
+  Entry store(std::string_view val);
+
+public:
+  PoolMass();
+
+  bool is_empty() const;
+  void reserve(int new_capacity, std::size_t bytes = 0);
+  void push_back(std::string_view val);
+  void insert_at(int index, std::string_view val);
+  void del_at(int index);
+  std::string_view get_at(int index) const;
+  void replace_at(int index, std::string_view val);
+  int get_size() const;
+  void print() const;
+
+  std::size_t bytes_used() const;   // полезные байты строк
+  std::size_t memory_usage() const; // выделенная память арены и таблицы
+  void compact();                   // убрать мусор после replace_at/del_at
+
+  // Бинарная сериализация в формате Mass
+  void serialize(std::ostream &out) const;
+  void deserialize(std::istream &in);
+};
@@ -0,0 +1,170 @@
+#include "seg_array.hpp"
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+// Конструктор
+SegMass::SegMass(int block_size)
+    : size(0), block_size(block_size < 2 ? 2 : block_size) {}
+
+// Проверка на пустоту
+bool SegMass::is_empty() const { return size == 0; }
+
+// Номер блока, в котором лежит index (0 <= index < size)
+int SegMass::block_of(int index) const {
+  return static_cast<int>(upper_bound(starts.begin(), starts.end(), index) -
+                          starts.begin()) -
+         1;
+}
+
+// Пересчёт начальных индексов блоков
+void SegMass::renumber(int from_block) {
+  int pos = from_block == 0 ? 0
+                            : starts[from_block - 1] +
+                                  static_cast<int>(blocks[from_block - 1].size());
+  for (int b = from_block; b < static_cast<int>(blocks.size()); ++b) {
+    starts[b] = pos;
+    pos += static_cast<int>(blocks[b].size());
+  }
+}
+
+// Деление блока пополам (строки переносятся перемещением)
+void SegMass::split(int b) {
+  vector<string> &full = blocks[b];
+  int half = static_cast<int>(full.size()) / 2;
+  vector<string> right;
+  right.reserve(block_size);
+  move(full.begin() + half, full.end(), back_inserter(right));
+  full.erase(full.begin() + half, full.end());
+  blocks.insert(blocks.begin() + b + 1, std::move(right));
+  starts.insert(starts.begin() + b + 1, starts[b] + half);
+}
+
+// Удаление пустого блока или слияние с соседом, если оба малы
+void SegMass::merge_small(int b) {
+  if (blocks[b].empty()) {
+    blocks.erase(blocks.begin() + b);
+    starts.erase(starts.begin() + b);
+    return;
+  }
+  int next = b + 1;
+  if (next >= static_cast<int>(blocks.size()) ||
+      static_cast<int>(blocks[b].size()) > block_size / 4 ||
+      blocks[b].size() + blocks[next].size() > static_cast<size_t>(block_size))
+    return;
+  move(blocks[next].begin(), blocks[next].end(), back_inserter(blocks[b]));
+  blocks.erase(blocks.begin() + next);
+  starts.erase(starts.begin() + next);
+}
+
+// Добавление элемента в конец
+void SegMass::push_back(const string &val) { insert_at(size, val); }
+
+// Вставка элемента по индексу
+void SegMass::insert_at(int index, const string &val) {
+  if (index < 0 || index > size)
+    return;
+  // Вставка в конец при полном последнем блоке открывает новый блок:
+  // деление пополам оставило бы после серии push_back блоки полупустыми
+  if (blocks.empty() ||
+      (index == size && static_cast<int>(blocks.back().size()) == block_size)) {
+    blocks.emplace_back();
+    blocks.back().reserve(block_size);
+    starts.push_back(size);
+  }
+  int b = index == size ? static_cast<int>(blocks.size()) - 1 : block_of(index);
+  vector<string> &block = blocks[b];
+  block.insert(block.begin() + (index - starts[b]), val);
+  ++size;
+  if (static_cast<int>(block.size()) > block_size)
+    split(b);
+  renumber(b + 1);
+}
+
+// Удаление элемента по индексу
+void SegMass::del_at(int index) {
+  if (index < 0 || index >= size)
+    return;
+  int b = block_of(index);
+  blocks[b].erase(blocks[b].begin() + (index - starts[b]));
+  --size;
+  merge_small(b);
+  renumber(b);
+}
+
+// Получение элемента по индексу
+string SegMass::get_at(int index) const {
+  if (index < 0 || index >= size)
+    return "";
+  int b = block_of(index);
+  return blocks[b][index - starts[b]];
+}
+
+// Просмотр элемента без копирования
+string_view SegMass::view_at(int index) const {
+  if (index < 0 || index >= size)
+    return string_view();
+  int b = block_of(index);
+  return blocks[b][index - starts[b]];
+}
+
+// Замена элемента по индексу
+void SegMass::replace_at(int index, const string &val) {
+  if (index < 0 || index >= size)
+    return;
+  int b = block_of(index);
+  blocks[b][index - starts[b]] = val;
+}
+
+// Получение размера массива
+int SegMass::get_size() const { return size; }
+
+// Число блоков
+int SegMass::get_block_count() const { return static_cast<int>(blocks.size()); }
+
+// Печать всех элементов
+void SegMass::print() const {
+  for (const vector<string> &block : blocks) {
+    for (const string &s : block) {
+      cout << s << " ";
+    }
+  }
+  cout << endl;
+}
+
+// Бинарная сериализация
+void SegMass::serialize(std::ostream &out) const {
+  out.write(reinterpret_cast<const char *>(&size), sizeof(int));
+  for (const vector<string> &block : blocks) {
+    for (const string &s : block) {
+      int len = s.length();
+      out.write(reinterpret_cast<const char *>(&len), sizeof(int));
+      out.write(s.c_str(), len);
+    }
+  }
+}
+
+// Бинарная десериализация: блоки заполняются целиком
+void SegMass::deserialize(std::istream &in) {
+  int new_size = 0;
+  in.read(reinterpret_cast<char *>(&new_size), sizeof(int));
+
+  blocks.clear();
+  starts.clear();
+  size = 0;
+
+  for (int i = 0; i < new_size; ++i) {
+    int len = 0;
+    in.read(reinterpret_cast<char *>(&len), sizeof(int));
+
+    string val(len, '\0');
+    in.read(&val[0], len);
+    if (blocks.empty() || static_cast<int>(blocks.back().size()) == block_size) {
+      blocks.emplace_back();
+      blocks.back().reserve(block_size);
+      starts.push_back(size);
+    }
+    blocks.back().push_back(std::move(val));
+    ++size;
+  }
+}
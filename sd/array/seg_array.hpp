@@ -0,0 +1,42 @@
+#pragma once
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Сегментированный массив строк с интерфейсом Mass.
+// Элементы лежат в блоках не длиннее block_size, starts[b] — индекс
+// первого элемента блока b. Вставка/удаление в середине сдвигают
+// только один блок и пересчитывают индекс блоков; поиск блока по
+// индексу — бинарный поиск по starts.
+class SegMass {
+private:
+  std::vector<std::vector<std::string>> blocks;
+  std::vector<int> starts;
+  int size;
+  int block_size;
+
+  int block_of(int index) const; // блок, содержащий index
+  void renumber(int from_block); // пересчёт starts начиная с блока
+  void split(int b);             // деление переполненного блока
+  void merge_small(int b);       // слияние недозаполненного блока
+
+public:
+  explicit SegMass(int block_size = 512);
+
+  bool is_empty() const;
+  void push_back(const std::string &val);
+  void insert_at(int index, const std::string &val);
+  void del_at(int index);
+  std::string get_at(int index) const;
+  std::string_view view_at(int index) const;
+  void replace_at(int index, const std::string &val);
+  int get_size() const;
+  int get_block_count() const;
+  void print() const;
+
+  // Бинарная сериализация в формате Mass
+  void serialize(std::ostream &out) const;
+  void deserialize(std::istream &in);
+};
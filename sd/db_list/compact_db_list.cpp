@@ -0,0 +1,250 @@
+#include "compact_db_list.hpp"
+#include <iostream>
+using namespace std;
+
+CompactDoublyList::CompactDoublyList()
+    : head(NIL), tail(NIL), free_head(NIL), size(0) {}
+
+bool CompactDoublyList::is_empty() const { return head == NIL; }
+
+int CompactDoublyList::get_size() const { return size; }
+
+size_t CompactDoublyList::memory_usage() const {
+  return nodes.capacity() * sizeof(CNode);
+}
+
+// Занять ячейку: из списка свободных или в конце вектора
+uint32_t CompactDoublyList::alloc_node(const string &val) {
+  uint32_t i;
+  if (free_head != NIL) {
+    i = free_head;
+    free_head = nodes[i].next;
+    nodes[i].data = val;
+  } else {
+    i = static_cast<uint32_t>(nodes.size());
+    CNode node{val, NIL, NIL}; // копия до роста: val может лежать в nodes
+    nodes.push_back(std::move(node));
+  }
+  nodes[i].prev = nodes[i].next = NIL;
+  ++size;
+  return i;
+}
+
+// Вернуть ячейку в список свободных
+void CompactDoublyList::free_node(uint32_t i) {
+  nodes[i].data.clear();
+  nodes[i].data.shrink_to_fit();
+  nodes[i].prev = NIL;
+  nodes[i].next = free_head;
+  free_head = i;
+  --size;
+}
+
+uint32_t CompactDoublyList::find_index(const string &key) const {
+  for (uint32_t i = head; i != NIL; i = nodes[i].next) {
+    if (nodes[i].data == key)
+      return i;
+  }
+  return NIL;
+}
+
+uint32_t CompactDoublyList::index_at(int index) const {
+  if (index < 0 || index >= size)
+    return NIL;
+  uint32_t i;
+  if (index < size / 2) {
+    i = head;
+    while (index-- > 0)
+      i = nodes[i].next;
+  } else {
+    i = tail;
+    for (int k = size - 1; k > index; --k)
+      i = nodes[i].prev;
+  }
+  return i;
+}
+
+// Вставить узел i перед pos
+void CompactDoublyList::link_before(uint32_t pos, uint32_t i) {
+  uint32_t prev = pos == NIL ? tail : nodes[pos].prev;
+  nodes[i].prev = prev;
+  nodes[i].next = pos;
+  if (prev != NIL)
+    nodes[prev].next = i;
+  else
+    head = i;
+  if (pos != NIL)
+    nodes[pos].prev = i;
+  else
+    tail = i;
+}
+
+// Вырезать узел i из цепочки
+void CompactDoublyList::unlink(uint32_t i) {
+  uint32_t prev = nodes[i].prev;
+  uint32_t next = nodes[i].next;
+  if (prev != NIL)
+    nodes[prev].next = next;
+  else
+    head = next;
+  if (next != NIL)
+    nodes[next].prev = prev;
+  else
+    tail = prev;
+}
+
+// Перепаковать узлы подряд в порядке обхода и отдать лишнюю память
+void CompactDoublyList::shrink_to_fit() {
+  vector<CNode> packed;
+  packed.reserve(size);
+  for (uint32_t i = head; i != NIL; i = nodes[i].next) {
+    uint32_t k = static_cast<uint32_t>(packed.size());
+    packed.push_back(CNode{std::move(nodes[i].data), k == 0 ? NIL : k - 1, k + 1});
+  }
+  if (!packed.empty())
+    packed.back().next = NIL;
+  nodes.swap(packed);
+  head = nodes.empty() ? NIL : 0;
+  tail = nodes.empty() ? NIL : static_cast<uint32_t>(nodes.size() - 1);
+  free_head = NIL;
+}
+
+string *CompactDoublyList::find(const string &key) {
+  uint32_t i = find_index(key);
+  return i == NIL ? nullptr : &nodes[i].data;
+}
+
+const string *CompactDoublyList::find(const string &key) const {
+  uint32_t i = find_index(key);
+  return i == NIL ? nullptr : &nodes[i].data;
+}
+
+// Добавить в конец
+void CompactDoublyList::push_back(const string &val) {
+  link_before(NIL, alloc_node(val));
+}
+
+// Добавить в начало
+void CompactDoublyList::push_front(const string &val) {
+  link_before(head, alloc_node(val));
+}
+
+// Вставка после ключа
+void CompactDoublyList::insert_after(const string &key, const string &val) {
+  uint32_t cur = find_index(key);
+  if (cur == NIL) {
+    cout << "Элемент '" << key << "' не найден.\n";
+    return;
+  }
+  link_before(nodes[cur].next, alloc_node(val));
+}
+
+// Вставка перед ключом
+void CompactDoublyList::insert_before(const string &key, const string &val) {
+  uint32_t cur = find_index(key);
+  if (cur == NIL) {
+    cout << "Элемент '" << key << "' не найден.\n";
+    return;
+  }
+  link_before(cur, alloc_node(val));
+}
+
+// Удалить элемент по значению
+void CompactDoublyList::del(const string &val) {
+  uint32_t cur = find_index(val);
+  if (cur == NIL) {
+    cout << "Элемент '" << val << "' не найден.\n";
+    return;
+  }
+  unlink(cur);
+  free_node(cur);
+}
+
+// Удалить голову
+void CompactDoublyList::del_head() {
+  if (is_empty())
+    return;
+  uint32_t i = head;
+  unlink(i);
+  free_node(i);
+}
+
+// Удалить хвост
+void CompactDoublyList::del_tail() {
+  if (is_empty())
+    return;
+  uint32_t i = tail;
+  unlink(i);
+  free_node(i);
+}
+
+// Удалить элемент после ключа
+void CompactDoublyList::del_after(const string &key) {
+  uint32_t cur = find_index(key);
+  if (cur == NIL || nodes[cur].next == NIL)
+    return;
+  uint32_t i = nodes[cur].next;
+  unlink(i);
+  free_node(i);
+}
+
+// Удалить элемент перед ключом
+void CompactDoublyList::del_before(const string &key) {
+  uint32_t cur = find_index(key);
+  if (cur == NIL || nodes[cur].prev == NIL)
+    return;
+  uint32_t i = nodes[cur].prev;
+  unlink(i);
+  free_node(i);
+}
+
+// Получить элемент по индексу (обход с ближнего конца)
+string *CompactDoublyList::get_at(int index) {
+  uint32_t i = index_at(index);
+  return i == NIL ? nullptr : &nodes[i].data;
+}
+
+const string *CompactDoublyList::get_at(int index) const {
+  uint32_t i = index_at(index);
+  return i == NIL ? nullptr : &nodes[i].data;
+}
+
+// Печать вперёд
+void CompactDoublyList::print_forward() const {
+  for (uint32_t i = head; i != NIL; i = nodes[i].next)
+    cout << nodes[i].data << " ";
+  cout << endl;
+}
+
+// Печать назад
+void CompactDoublyList::print_backward() const {
+  for (uint32_t i = tail; i != NIL; i = nodes[i].prev)
+    cout << nodes[i].data << " ";
+  cout << endl;
+}
+
+// Текстовая сериализация
+void CompactDoublyList::serialize(std::ostream &out) const {
+  out << size << "\n";
+  for (uint32_t i = head; i != NIL; i = nodes[i].next)
+    out << nodes[i].data << "\n";
+}
+
+// Текстовая десериализация
+void CompactDoublyList::deserialize(std::istream &in) {
+  int new_size = 0;
+  in >> new_size;
+  in.ignore(); // пропустить перевод строки
+
+  nodes.clear();
+  head = tail = free_head = NIL;
+  size = 0;
+  if (new_size > 0)
+    nodes.reserve(new_size);
+
+  for (int i = 0; i < new_size; ++i) {
+    std::string val;
+    std::getline(in, val);
+    push_back(val);
+  }
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Компактный двусвязный список: узлы лежат в одном векторе, связи —
+// 32-битные индексы, освобождённые ячейки собираются в список свободных.
+// Интерфейс повторяет DoublyList; find и get_at возвращают указатель на
+// строку, действительный до следующей вставки.
+class CompactDoublyList {
+private:
+  static constexpr std::uint32_t NIL = UINT32_MAX;
+
+  struct CNode {
+    std::string data;
+    std::uint32_t prev;
+    std::uint32_t next; // для свободной ячейки — следующая свободная
+  };
+
+  std::vector<CNode> nodes;
+  std::uint32_t head;
+  std::uint32_t tail;
+  std::uint32_t free_head;
+  int size;
+
+  std::uint32_t alloc_node(const std::string &val);
+  void free_node(std::uint32_t i);
+  std::uint32_t find_index(const std::string &key) const;
+  std::uint32_t index_at(int index) const;
+  void link_before(std::uint32_t pos, std::uint32_t i); // NIL — в конец
+  void unlink(std::uint32_t i);
+
+public:
+  CompactDoublyList();
+
+  bool is_empty() const;
+  int get_size() const;
+  std::size_t memory_usage() const; // байты вектора узлов
+  void shrink_to_fit();             // перепаковка в порядке обхода
+
+  std::string *find(const std::string &key);
+  const std::string *find(const std::string &key) const;
+  void push_back(const std::string &val);
+  void push_front(const std::string &val);
+  void insert_after(const std::string &key, const std::string &val);
+  void insert_before(const std::string &key, const std::string &val);
+  void del(const std::string &val);
+  void del_head();
+  void del_tail();
+  void del_after(const std::string &key);
+  void del_before(const std::string &key);
+  std::string *get_at(int index);
+  const std::string *get_at(int index) const;
+  void print_forward() const;
+  void print_backward() const;
+
+  // Текстовая сериализация и десериализация (формат DoublyList)
+  void serialize(std::ostream &out) const;
+  void deserialize(std::istream &in);
+};
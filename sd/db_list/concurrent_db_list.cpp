@@ -0,0 +1,336 @@
+#include "concurrent_db_list.hpp"
+#include <iostream>
+#include <thread>
+#include <vector>
+using namespace std;
+
+ConcurrentDoublyList::ConcurrentDoublyList() : first(""), last(""), size(0) {
+  first.next = &last;
+  last.prev = &first;
+}
+
+ConcurrentDoublyList::~ConcurrentDoublyList() {
+  CNode *cur = first.next;
+  while (cur != &last) {
+    CNode *tmp = cur;
+    cur = cur->next;
+    delete tmp;
+  }
+}
+
+bool ConcurrentDoublyList::is_empty() const { return size.load() == 0; }
+
+int ConcurrentDoublyList::get_size() const { return size.load(); }
+
+// Обход «рука за руку» от головы
+void ConcurrentDoublyList::lock_find(const string &key, CNode *&prev,
+                                     CNode *&cur) const {
+  prev = &first;
+  prev->m.lock();
+  cur = prev->next;
+  cur->m.lock();
+  while (cur != &last && cur->data != key) {
+    prev->m.unlock();
+    prev = cur;
+    cur = cur->next;
+    cur->m.lock();
+  }
+}
+
+// Хвостовой узел: сначала ограничитель last, затем соседи слева через
+// try_lock (порядок обратный обходу, поэтому ждать нельзя)
+bool ConcurrentDoublyList::lock_tail(CNode *&prev, CNode *&node) {
+  for (;;) {
+    last.m.lock();
+    node = last.prev;
+    if (node == &first) {
+      last.m.unlock();
+      return false;
+    }
+    if (node->m.try_lock()) {
+      prev = node->prev;
+      if (prev->m.try_lock())
+        return true;
+      node->m.unlock();
+    }
+    last.m.unlock();
+    std::this_thread::yield();
+  }
+}
+
+// Вставить node между захваченными соседями a и b
+void ConcurrentDoublyList::link_between(CNode *a, CNode *b, CNode *node) {
+  node->prev = a;
+  node->next = b;
+  a->next = node;
+  b->prev = node;
+  size.fetch_add(1);
+}
+
+// Вырезать node; захвачены node и оба соседа
+void ConcurrentDoublyList::unlink(CNode *node) {
+  node->prev->next = node->next;
+  node->next->prev = node->prev;
+  size.fetch_sub(1);
+}
+
+bool ConcurrentDoublyList::contains(const string &key) const {
+  CNode *prev, *cur;
+  lock_find(key, prev, cur);
+  bool found = cur != &last;
+  cur->m.unlock();
+  prev->m.unlock();
+  return found;
+}
+
+// Добавить в конец
+void ConcurrentDoublyList::push_back(const string &val) {
+  CNode *node = new CNode(val);
+  for (;;) {
+    last.m.lock();
+    CNode *prev = last.prev;
+    if (prev->m.try_lock()) {
+      link_between(prev, &last, node);
+      prev->m.unlock();
+      last.m.unlock();
+      return;
+    }
+    last.m.unlock();
+    std::this_thread::yield();
+  }
+}
+
+// Добавить в начало
+void ConcurrentDoublyList::push_front(const string &val) {
+  CNode *node = new CNode(val);
+  lock_guard<mutex> a(first.m);
+  lock_guard<mutex> b(first.next->m);
+  link_between(&first, first.next, node);
+}
+
+// Вставка после ключа
+bool ConcurrentDoublyList::insert_after(const string &key, const string &val) {
+  CNode *prev, *cur;
+  lock_find(key, prev, cur);
+  prev->m.unlock();
+  if (cur == &last) {
+    cur->m.unlock();
+    return false;
+  }
+  CNode *next = cur->next;
+  next->m.lock();
+  link_between(cur, next, new CNode(val));
+  next->m.unlock();
+  cur->m.unlock();
+  return true;
+}
+
+// Вставка перед ключом
+bool ConcurrentDoublyList::insert_before(const string &key, const string &val) {
+  CNode *prev, *cur;
+  lock_find(key, prev, cur);
+  bool found = cur != &last;
+  if (found)
+    link_between(prev, cur, new CNode(val));
+  cur->m.unlock();
+  prev->m.unlock();
+  return found;
+}
+
+// Удалить элемент по значению
+bool ConcurrentDoublyList::del(const string &val) {
+  CNode *prev, *cur;
+  lock_find(val, prev, cur);
+  if (cur == &last) {
+    cur->m.unlock();
+    prev->m.unlock();
+    return false;
+  }
+  CNode *next = cur->next;
+  next->m.lock();
+  unlink(cur);
+  next->m.unlock();
+  cur->m.unlock();
+  prev->m.unlock();
+  // Ждать замка cur некому: до него можно дойти только через prev или next
+  delete cur;
+  return true;
+}
+
+// Удалить элемент после ключа
+bool ConcurrentDoublyList::del_after(const string &key) {
+  CNode *prev, *cur;
+  lock_find(key, prev, cur);
+  prev->m.unlock();
+  CNode *victim = cur == &last ? &last : cur->next;
+  if (victim == &last) {
+    cur->m.unlock();
+    return false;
+  }
+  victim->m.lock();
+  CNode *next = victim->next;
+  next->m.lock();
+  unlink(victim);
+  next->m.unlock();
+  victim->m.unlock();
+  cur->m.unlock();
+  delete victim;
+  return true;
+}
+
+// Удалить элемент перед ключом: окно из трёх захваченных узлов
+bool ConcurrentDoublyList::del_before(const string &key) {
+  CNode *pp = &first;
+  pp->m.lock();
+  CNode *prev = pp->next;
+  if (prev == &last) {
+    pp->m.unlock();
+    return false;
+  }
+  prev->m.lock();
+  if (prev->data == key) { // ключ в голове — перед ним ничего нет
+    prev->m.unlock();
+    pp->m.unlock();
+    return false;
+  }
+  CNode *cur = prev->next;
+  cur->m.lock();
+  while (cur != &last && cur->data != key) {
+    pp->m.unlock();
+    pp = prev;
+    prev = cur;
+    cur = cur->next;
+    cur->m.lock();
+  }
+  bool found = cur != &last;
+  if (found)
+    unlink(prev);
+  cur->m.unlock();
+  prev->m.unlock();
+  pp->m.unlock();
+  if (found)
+    delete prev;
+  return found;
+}
+
+// Снять голову
+bool ConcurrentDoublyList::pop_front(string &out) {
+  first.m.lock();
+  CNode *node = first.next;
+  if (node == &last) {
+    first.m.unlock();
+    return false;
+  }
+  node->m.lock();
+  CNode *next = node->next;
+  next->m.lock();
+  unlink(node);
+  next->m.unlock();
+  node->m.unlock();
+  first.m.unlock();
+  out = std::move(node->data);
+  delete node;
+  return true;
+}
+
+// Снять хвост
+bool ConcurrentDoublyList::pop_back(string &out) {
+  CNode *prev, *node;
+  if (!lock_tail(prev, node))
+    return false;
+  unlink(node);
+  prev->m.unlock();
+  node->m.unlock();
+  last.m.unlock();
+  out = std::move(node->data);
+  delete node;
+  return true;
+}
+
+void ConcurrentDoublyList::del_head() {
+  string tmp;
+  pop_front(tmp);
+}
+
+void ConcurrentDoublyList::del_tail() {
+  string tmp;
+  pop_back(tmp);
+}
+
+// Копия элемента по индексу
+bool ConcurrentDoublyList::get_at(int index, string &out) const {
+  if (index < 0)
+    return false;
+  CNode *cur = &first;
+  cur->m.lock();
+  for (int i = 0; i <= index; ++i) {
+    CNode *next = cur->next;
+    next->m.lock();
+    cur->m.unlock();
+    cur = next;
+    if (cur == &last)
+      break;
+  }
+  bool found = cur != &last;
+  if (found)
+    out = cur->data;
+  cur->m.unlock();
+  return found;
+}
+
+// Печать вперёд
+void ConcurrentDoublyList::print_forward() const {
+  CNode *cur = &first;
+  cur->m.lock();
+  for (;;) {
+    CNode *next = cur->next;
+    next->m.lock();
+    cur->m.unlock();
+    cur = next;
+    if (cur == &last)
+      break;
+    cout << cur->data << " ";
+  }
+  cur->m.unlock();
+  cout << endl;
+}
+
+// Печать назад: обход против порядка замков, поэтому по снимку
+void ConcurrentDoublyList::print_backward() const {
+  vector<string> items;
+  CNode *cur = &first;
+  cur->m.lock();
+  for (;;) {
+    CNode *next = cur->next;
+    next->m.lock();
+    cur->m.unlock();
+    cur = next;
+    if (cur == &last)
+      break;
+    items.push_back(cur->data);
+  }
+  cur->m.unlock();
+  for (auto it = items.rbegin(); it != items.rend(); ++it)
+    cout << *it << " ";
+  cout << endl;
+}
+
+// Текстовая сериализация
+void ConcurrentDoublyList::serialize(std::ostream &out) const {
+  vector<string> items;
+  CNode *cur = &first;
+  cur->m.lock();
+  for (;;) {
+    CNode *next = cur->next;
+    next->m.lock();
+    cur->m.unlock();
+    cur = next;
+    if (cur == &last)
+      break;
+    items.push_back(cur->data);
+  }
+  cur->m.unlock();
+  out << items.size() << "\n";
+  for (const string &s : items)
+    out << s << "\n";
+}
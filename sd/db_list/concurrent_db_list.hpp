@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+// Потокобезопасный двусвязный список с блокировкой на каждом узле.
+// Обход идёт «рука за руку» (захватить следующий, отпустить предыдущий),
+// правка держит замки соседей вокруг места вставки или удаления, поэтому
+// операции над разными участками списка идут параллельно. Замки берутся
+// слева направо; операции с хвоста захватывают левого соседа через
+// try_lock и повторяют попытку при конфликте. Указатели на узлы наружу
+// не отдаются: значения возвращаются копией. Отсутствие ключа сообщается
+// результатом false, а не печатью — вывод из потоков перемешивался бы.
+class ConcurrentDoublyList {
+private:
+  struct CNode {
+    std::string data;
+    CNode *next;
+    CNode *prev;
+    std::mutex m;
+    CNode(const std::string &val) : data(val), next(nullptr), prev(nullptr) {}
+  };
+
+  // Ограничители: настоящие узлы всегда лежат между ними
+  mutable CNode first;
+  mutable CNode last;
+  std::atomic<int> size;
+
+  // Найти первое вхождение key; на выходе захвачены prev и cur
+  // (cur == &last, если не найден)
+  void lock_find(const std::string &key, CNode *&prev, CNode *&cur) const;
+  // Захватить хвостовой узел и его соседей; false, если список пуст
+  bool lock_tail(CNode *&prev, CNode *&node);
+  void link_between(CNode *a, CNode *b, CNode *node);
+  void unlink(CNode *node);
+
+public:
+  ConcurrentDoublyList();
+  ~ConcurrentDoublyList();
+
+  ConcurrentDoublyList(const ConcurrentDoublyList &) = delete;
+  ConcurrentDoublyList &operator=(const ConcurrentDoublyList &) = delete;
+
+  bool is_empty() const;
+  int get_size() const;
+
+  bool contains(const std::string &key) const;
+  void push_back(const std::string &val);
+  void push_front(const std::string &val);
+  bool insert_after(const std::string &key, const std::string &val);
+  bool insert_before(const std::string &key, const std::string &val);
+  bool del(const std::string &val);
+  bool del_after(const std::string &key);
+  bool del_before(const std::string &key);
+  bool pop_front(std::string &out);
+  bool pop_back(std::string &out);
+  void del_head();
+  void del_tail();
+  bool get_at(int index, std::string &out) const;
+  void print_forward() const;
+  void print_backward() const;
+
+  // Текстовая сериализация (формат DoublyList); при параллельных правках
+  // каждый узел читается под своим замком, но общего снимка нет
+  void serialize(std::ostream &out) const;
+};
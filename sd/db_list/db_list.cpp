@@ -1,15 +1,17 @@
 #include "db_list.hpp"
 #include <iostream>
+#include <new>
 using namespace std;
 
-DoublyList::DoublyList() : head(nullptr), tail(nullptr) {}
+DoublyList::DoublyList()
+    : head(nullptr), tail(nullptr), positioned(false) {}
 
 DoublyList::~DoublyList() {
   DNode *cur = head;
   while (cur) {
     DNode *tmp = cur;
     cur = cur->next;
-    delete tmp;
+    free_node(tmp);
   }
 }
 
@@ -25,7 +27,24 @@ DoublyList::DNode *DoublyList::find(const string &key) const {
   return nullptr;
 }
 
+// Первое вхождение key и его позиция
+DoublyList::DNode *DoublyList::find_rank(const string &key, int &rank) const {
+  rank = 0;
+  for (DNode *cur = head; cur; cur = cur->next, ++rank) {
+    if (cur->data == key)
+      return cur;
+  }
+  return nullptr;
+}
+
+// Позиция узла этого списка по индексу
+int DoublyList::rank_of(const DNode *node) const {
+  return positions.rank_of(node);
+}
+
 int DoublyList::get_size() const {
+  if (positioned)
+    return positions.size();
   int count = 0;
   DNode *cur = head;
   while (cur) {
@@ -36,7 +55,7 @@ int DoublyList::get_size() const {
 }
 
 // Добавить в конец
-void DoublyList::push_back(const string &val) {
+DoublyList::cursor DoublyList::push_back(const string &val) {
   DNode *node = new DNode(val);
   if (is_empty()) {
     head = tail = node;
@@ -45,10 +64,13 @@ void DoublyList::push_back(const string &val) {
     node->prev = tail;
     tail = node;
   }
+  if (positioned)
+    position_insert(node, positions.size());
+  return cursor(this, node);
 }
 
 // Добавить в начало
-void DoublyList::push_front(const string &val) {
+DoublyList::cursor DoublyList::push_front(const string &val) {
   DNode *node = new DNode(val);
   if (is_empty()) {
     head = tail = node;
@@ -57,11 +79,14 @@ void DoublyList::push_front(const string &val) {
     head->prev = node;
     head = node;
   }
+  position_insert(node, 0);
+  return cursor(this, node);
 }
 
 // Вставка после ключа
 void DoublyList::insert_after(const string &key, const string &val) {
-  DNode *cur = find(key);
+  int rank = 0;
+  DNode *cur = find_rank(key, rank);
   if (!cur) {
     cout << "Элемент '" << key << "' не найден.\n";
     return;
@@ -75,11 +100,13 @@ void DoublyList::insert_after(const string &key, const string &val) {
   cur->next = node;
   if (cur == tail)
     tail = node;
+  position_insert(node, rank + 1);
 }
 
 // Вставка перед ключом
 void DoublyList::insert_before(const string &key, const string &val) {
-  DNode *cur = find(key);
+  int rank = 0;
+  DNode *cur = find_rank(key, rank);
   if (!cur) {
     cout << "Элемент '" << key << "' не найден.\n";
     return;
@@ -93,11 +120,13 @@ void DoublyList::insert_before(const string &key, const string &val) {
   else
     head = node;
   cur->prev = node;
+  position_insert(node, rank);
 }
 
 // Удалить элемент по значению
 void DoublyList::del(const string &val) {
-  DNode *cur = find(val);
+  int rank = 0;
+  DNode *cur = find_rank(val, rank);
   if (!cur) {
     cout << "Элемент '" << val << "' не найден.\n";
     return;
@@ -113,7 +142,8 @@ void DoublyList::del(const string &val) {
   else
     tail = cur->prev;
 
-  delete cur;
+  position_erase(rank);
+  free_node(cur);
 }
 
 // Удалить голову
@@ -126,7 +156,8 @@ void DoublyList::del_head() {
     head->prev = nullptr;
   else
     tail = nullptr;
-  delete tmp;
+  position_erase(0);
+  free_node(tmp);
 }
 
 // Удалить хвост
@@ -139,12 +170,15 @@ void DoublyList::del_tail() {
     tail->next = nullptr;
   else
     head = nullptr;
-  delete tmp;
+  if (positioned)
+    position_erase(positions.size() - 1);
+  free_node(tmp);
 }
 
 // Удалить элемент после ключа
 void DoublyList::del_after(const string &key) {
-  DNode *cur = find(key);
+  int rank = 0;
+  DNode *cur = find_rank(key, rank);
   if (!cur || !cur->next)
     return;
   DNode *tmp = cur->next;
@@ -155,12 +189,14 @@ void DoublyList::del_after(const string &key) {
   else
     tail = cur;
 
-  delete tmp;
+  position_erase(rank + 1);
+  free_node(tmp);
 }
 
 // Удалить элемент перед ключом
 void DoublyList::del_before(const string &key) {
-  DNode *cur = find(key);
+  int rank = 0;
+  DNode *cur = find_rank(key, rank);
   if (!cur || !cur->prev)
     return;
   DNode *tmp = cur->prev;
@@ -171,13 +207,16 @@ void DoublyList::del_before(const string &key) {
   else
     head = cur;
 
-  delete tmp;
+  position_erase(rank - 1);
+  free_node(tmp);
 }
 
 // Получить элемент по индексу
 DoublyList::DNode *DoublyList::get_at(int index) const {
   if (index < 0)
     return nullptr;
+  if (positioned)
+    return positions.at(index, head);
   DNode *cur = head;
   int i = 0;
   while (cur && i < index) {
@@ -187,6 +226,74 @@ DoublyList::DNode *DoublyList::get_at(int index) const {
   return cur;
 }
 
+// Вставка так, чтобы новый элемент оказался на позиции index
+DoublyList::cursor DoublyList::insert_at(int index, const string &val) {
+  if (index < 0)
+    return end();
+  DNode *pos = get_at(index);
+  if (!pos)
+    return index == get_size() ? push_back(val) : end();
+  DNode *node = new DNode(val);
+  link_before(pos, node, node);
+  position_insert(node, index);
+  return cursor(this, node);
+}
+
+// Удаление элемента на позиции index
+void DoublyList::del_at(int index) {
+  DNode *cur = get_at(index);
+  if (!cur)
+    return;
+  position_erase(index);
+  unlink_range(cur, cur);
+  free_node(cur);
+}
+
+// Курсор на элемент по индексу (end(), если индекс вне списка)
+DoublyList::cursor DoublyList::cursor_at(int index) {
+  return cursor(this, get_at(index));
+}
+
+// Курсор на первое вхождение ключа (end(), если не найден)
+DoublyList::cursor DoublyList::cursor_of(const string &key) {
+  return cursor(this, find(key));
+}
+
+// Вставка перед курсором
+DoublyList::cursor DoublyList::insert_before(cursor pos, const string &val) {
+  if (!pos.node)
+    return push_back(val);
+  int rank = positioned ? rank_of(pos.node) : 0;
+  DNode *node = new DNode(val);
+  link_before(pos.node, node, node);
+  position_insert(node, rank);
+  return cursor(this, node);
+}
+
+// Вставка после курсора (после end() — в конец)
+DoublyList::cursor DoublyList::insert_after(cursor pos, const string &val) {
+  if (!pos.node || !pos.node->next)
+    return push_back(val);
+  int rank = positioned ? rank_of(pos.node) + 1 : 0;
+  DNode *node = new DNode(val);
+  link_before(pos.node->next, node, node);
+  position_insert(node, rank);
+  return cursor(this, node);
+}
+
+// Удаление узла под курсором
+DoublyList::cursor DoublyList::erase(cursor pos) {
+  DNode *cur = pos.node;
+  if (!cur)
+    return end();
+  DNode *next = cur->next;
+  if (positioned)
+    position_erase(rank_of(cur));
+  unlink_range(cur, cur);
+  free_node(cur);
+  return cursor(this, next);
+}
+
 // Печать вперёд
 void DoublyList::print_forward() const {
   DNode *cur = head;
@@ -207,6 +314,177 @@ void DoublyList::print_backward() const {
   cout << endl;
 }
 
+// Вставить цепочку first..last перед pos (nullptr — в конец)
+void DoublyList::link_before(DNode *pos, DNode *first, DNode *last) {
+  if (!pos) {
+    first->prev = tail;
+    last->next = nullptr;
+    if (tail)
+      tail->next = first;
+    else
+      head = first;
+    tail = last;
+  } else {
+    first->prev = pos->prev;
+    last->next = pos;
+    if (pos->prev)
+      pos->prev->next = first;
+    else
+      head = first;
+    pos->prev = last;
+  }
+}
+
+// Вырезать цепочку first..last из списка (узлы не удаляются)
+void DoublyList::unlink_range(DNode *first, DNode *last) {
+  if (first->prev)
+    first->prev->next = last->next;
+  else
+    head = last->next;
+  if (last->next)
+    last->next->prev = first->prev;
+  else
+    tail = first->prev;
+}
+
+// Перенос всех узлов other перед pos
+void DoublyList::splice(DNode *pos, DoublyList &other) {
+  if (&other == this || other.is_empty())
+    return;
+  DNode *first = other.head;
+  DNode *last = other.tail;
+  other.head = other.tail = nullptr;
+  link_before(pos, first, last);
+  slabs.share(other.slabs);
+  other.position_rebuild();
+  position_rebuild();
+}
+
+// Перенос узлов [first, last] из other перед pos
+void DoublyList::splice_range(DNode *pos, DoublyList &other, DNode *first,
+                              DNode *last) {
+  if (!first || !last || pos == first)
+    return;
+  other.unlink_range(first, last);
+  link_before(pos, first, last);
+  if (&other != this) {
+    slabs.share(other.slabs);
+    other.position_rebuild();
+  }
+  position_rebuild();
+}
+
+// Присоединить other в конец
+void DoublyList::concat(DoublyList &other) { splice(nullptr, other); }
+
+// Отделить хвост начиная с index в конец rest
+void DoublyList::split_at(int index, DoublyList &rest) {
+  if (&rest == this)
+    return;
+  DNode *first = get_at(index < 0 ? 0 : index);
+  if (!first)
+    return;
+  rest.splice_range(nullptr, *this, first, tail);
+}
+
+// Освободить узел: из блока compact() — на месте, иначе delete
+size_t DoublyList::free_node(DNode *node) {
+  size_t released = 0;
+  node->~DNode();
+  if (!slabs.release(node, released)) {
+    ::operator delete(node);
+    released = node_chain::heap_chunk(sizeof(DNode));
+  }
+  return released;
+}
+
+// Переложить узлы подряд в один блок в порядке обхода
+size_t DoublyList::compact() {
+  size_t count = static_cast<size_t>(get_size());
+  if (count == 0)
+    return 0;
+
+  char *block = static_cast<char *>(::operator new(count * sizeof(DNode)));
+  DNode *nodes = reinterpret_cast<DNode *>(block);
+  size_t before = 0;
+  size_t after = count * sizeof(DNode);
+  DNode *cur = head;
+  for (size_t i = 0; i < count; ++i) {
+    before += cur->data.capacity();
+    new (&nodes[i]) DNode(std::move(cur->data));
+    nodes[i].data.shrink_to_fit();
+    after += nodes[i].data.capacity();
+    nodes[i].prev = i > 0 ? &nodes[i - 1] : nullptr;
+    nodes[i].next = i + 1 < count ? &nodes[i + 1] : nullptr;
+    DNode *old = cur;
+    cur = cur->next;
+    before += free_node(old);
+  }
+  slabs.add(block, count * sizeof(DNode), count);
+  head = &nodes[0];
+  tail = &nodes[count - 1];
+  position_rebuild();
+  return before > after ? before - after : 0;
+}
+
+// Учесть в индексе узел, вставленный на позицию rank
+void DoublyList::position_insert(DNode *node, int rank) {
+  if (positioned)
+    positions.insert(rank, node);
+}
+
+// Учесть в индексе удаление узла с позиции rank
+void DoublyList::position_erase(int rank) {
+  if (positioned)
+    positions.erase(rank);
+}
+
+// Построить индекс заново за O(n) после перестановки многих узлов
+void DoublyList::position_rebuild() {
+  if (positioned)
+    positions.rebuild(head);
+}
+
+void DoublyList::enable_position_index() {
+  positioned = true;
+  positions.rebuild(head);
+}
+
+void DoublyList::disable_position_index() {
+  positioned = false;
+  positions.clear();
+}
+
+bool DoublyList::is_position_indexed() const { return positioned; }
+
+size_t DoublyList::position_index_memory_usage() const {
+  return positioned ? positions.memory_usage() : 0;
+}
+
+// Восстановить prev и tail после перевязки по next
+void DoublyList::relink_prev() {
+  DNode *prev = nullptr;
+  for (DNode *cur = head; cur; cur = cur->next) {
+    cur->prev = prev;
+    prev = cur;
+  }
+  tail = prev;
+}
+
+// Сортировка по возрастанию перевязкой узлов
+void DoublyList::sort() {
+  head = node_chain::merge_sort(head, get_size());
+  relink_prev();
+  position_rebuild();
+}
+
+// Многопоточная сортировка по возрастанию
+void DoublyList::parallel_sort(int threads) {
+  head = node_chain::parallel_merge_sort(head, get_size(), threads);
+  relink_prev();
+  position_rebuild();
+}
+
 // Текстовая сериализация
 void DoublyList::serialize(std::ostream &out) const {
   int size = get_size();
@@ -225,12 +503,14 @@ void DoublyList::deserialize(std::istream &in) {
   in >> size;
   in.ignore(); // пропустить перевод строки
 
-  // Очищаем список
+  // Очищаем список; индекс строится один раз после загрузки
+  bool was_positioned = positioned;
+  disable_position_index();
   DNode *cur = head;
   while (cur) {
     DNode *tmp = cur;
     cur = cur->next;
-    delete tmp;
+    free_node(tmp);
   }
   head = tail = nullptr;
 
@@ -240,4 +520,6 @@ void DoublyList::deserialize(std::istream &in) {
     std::getline(in, val);
     push_back(val);
   }
+  if (was_positioned)
+    enable_position_index();
 }
\ No newline at end of file
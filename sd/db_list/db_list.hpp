@@ -1,7 +1,13 @@
 #pragma once
+#include <cstddef>
+#include <iterator>
 #include <istream>
 #include <ostream>
 #include <string>
+#include <type_traits>
+
+#include "../list/node_chain.hpp"
+#include "skip_index.hpp"
 
 class DoublyList {
 private:
@@ -10,12 +16,71 @@ private:
     DNode *next;
     DNode *prev;
     DNode(const std::string &val) : data(val), next(nullptr), prev(nullptr) {}
+    DNode(std::string &&val)
+        : data(std::move(val)), next(nullptr), prev(nullptr) {}
   };
 
   DNode *head;
   DNode *tail;
+  node_chain::SlabSet slabs; // блоки compact(), из которых могут быть узлы
+
+  // Необязательный позиционный индекс (скип-лист со span). Операции по
+  // ключу узнают позицию узла попутно при поиске, правки по курсору — из
+  // самого индекса (rank_of), и индекс правится за O(log n). Перестановки
+  // многих узлов (splice, сортировка, compact, десериализация) строят его
+  // заново за O(n) сразу же, так что константные методы его только читают.
+  SkipIndex<DNode> positions;
+  bool positioned;
+
+  DNode *find_rank(const std::string &key, int &rank) const;
+  int rank_of(const DNode *node) const; // при включённом индексе
+  void position_insert(DNode *node, int rank);
+  void position_erase(int rank);
+  void position_rebuild();
+  void relink_prev();
+  void link_before(DNode *pos, DNode *first, DNode *last);
+  void unlink_range(DNode *first, DNode *last);
+  std::size_t free_node(DNode *node); // возвращает освобождённые байты (оценка)
 
 public:
+  // Двунаправленный итератор; --end() ведёт на хвост, поэтому итератор
+  // помнит список. V — std::string или const std::string.
+  template <typename V> class basic_iterator {
+    friend class DoublyList;
+    const DoublyList *owner;
+    DNode *node;
+
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::string;
+    using difference_type = std::ptrdiff_t;
+    using pointer = V *;
+    using reference = V &;
+
+    basic_iterator() : owner(nullptr), node(nullptr) {}
+    basic_iterator(const DoublyList *l, DNode *n) : owner(l), node(n) {}
+    // iterator -> const_iterator
+    template <typename W, typename = std::enable_if_t<
+                              std::is_const<V>::value && !std::is_const<W>::value>>
+    basic_iterator(const basic_iterator<W> &o) : owner(o.owner), node(o.node) {}
+
+    reference operator*() const { return node->data; }
+    pointer operator->() const { return &node->data; }
+    basic_iterator &operator++() { node = node->next; return *this; }
+    basic_iterator operator++(int) { basic_iterator t = *this; node = node->next; return t; }
+    basic_iterator &operator--() { node = node ? node->prev : owner->tail; return *this; }
+    basic_iterator operator--(int) { basic_iterator t = *this; --*this; return t; }
+    bool operator==(const basic_iterator &o) const { return node == o.node; }
+    bool operator!=(const basic_iterator &o) const { return node != o.node; }
+
+    template <typename W> friend class basic_iterator;
+  };
+  using iterator = basic_iterator<std::string>;
+  using const_iterator = basic_iterator<const std::string>;
+  // Курсор — итератор на узел: остаётся действительным при любых правках,
+  // кроме удаления его собственного узла
+  using cursor = iterator;
+
   DoublyList();
   ~DoublyList();
 
@@ -23,8 +88,8 @@ public:
   int get_size() const;
 
   DNode *find(const std::string &key) const;
-  void push_back(const std::string &val);
-  void push_front(const std::string &val);
+  cursor push_back(const std::string &val);
+  cursor push_front(const std::string &val);
   void insert_after(const std::string &key, const std::string &val);
   void insert_before(const std::string &key, const std::string &val);
   void del(const std::string &val);
@@ -33,9 +98,59 @@ public:
   void del_after(const std::string &key);
   void del_before(const std::string &key);
   DNode *get_at(int index) const;
+  // Вставка на позицию index (0..size, вставка становится index-м
+  // элементом; вне диапазона — end()) и удаление с позиции index.
+  // С позиционным индексом — O(log n) в среднем, без него — O(index).
+  cursor insert_at(int index, const std::string &val);
+  void del_at(int index);
+  // Правка по курсору за O(1); end() означает позицию после хвоста.
+  // Вставки возвращают курсор на новый узел, erase — на следующий.
+  cursor cursor_at(int index);
+  cursor cursor_of(const std::string &key);
+  cursor insert_before(cursor pos, const std::string &val);
+  cursor insert_after(cursor pos, const std::string &val);
+  cursor erase(cursor pos);
+
   void print_forward() const;
   void print_backward() const;
 
+  // Перенос узлов между списками перевязкой указателей, без копирования
+  // строк, за O(1). pos — узел этого списка (find/get_at), вставка идёт
+  // перед ним, nullptr — в конец. splice_range переносит [first, last]
+  // из other; в пределах одного списка pos не должен лежать в диапазоне.
+  void splice(DNode *pos, DoublyList &other);
+  void splice_range(DNode *pos, DoublyList &other, DNode *first, DNode *last);
+  void concat(DoublyList &other);
+  // Перенести элементы с позиции index до конца в конец rest: O(index)
+  void split_at(int index, DoublyList &rest);
+
+  // Дефрагментация: узлы переезжают в один блок в порядке обхода, лишняя
+  // ёмкость строк отдаётся. Возвращает оценку, а не замер: ёмкость
+  // строк плюс старые узлы по модели glibc malloc (служебное слово,
+  // выравнивание до 16 байт, не меньше 32) за вычетом нового блока.
+  // Курсоры и указатели на узлы после вызова недействительны.
+  std::size_t compact();
+
+  // Устойчивая сортировка слиянием снизу вверх перевязкой узлов, без
+  // выделения памяти; prev и tail восстанавливаются одним проходом
+  void sort();
+  void parallel_sort(int threads = 0); // threads = 0 — по числу ядер
+
+  // Позиционный индекс: get_at, insert_at, del_at и get_size за
+  // O(log n) в среднем вместо O(n), в том числе вперемешку с правками по
+  // курсору; splice, сортировка и compact перестраивают его за O(n)
+  void enable_position_index();
+  void disable_position_index();
+  bool is_position_indexed() const;
+  std::size_t position_index_memory_usage() const; // оценка в байтах
+
+  iterator begin() { return iterator(this, head); }
+  iterator end() { return iterator(this, nullptr); }
+  const_iterator begin() const { return const_iterator(this, head); }
+  const_iterator end() const { return const_iterator(this, nullptr); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
   // Текстовая сериализация и десериализация
   void serialize(std::ostream &out) const;
   void deserialize(std::istream &in);
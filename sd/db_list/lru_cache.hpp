@@ -0,0 +1,209 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+// Вес записи для лимита по байтам: у строк — длина, у прочих — sizeof
+struct LRUWeigher {
+  std::size_t operator()(const std::string &s) const { return s.size(); }
+  template <typename T> std::size_t operator()(const T &) const {
+    return sizeof(T);
+  }
+};
+
+// LRU-кэш: хэш-таблица ключ -> запись, записи сцеплены в двусвязный
+// список по давности обращения (голова — самая свежая). get, put и erase
+// работают за O(1) в среднем. Узлы unordered_map не перемещаются при
+// рехэше, поэтому список хранит указатели прямо на них.
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename Weigher = LRUWeigher>
+class LRUCache {
+private:
+  struct Entry;
+  using Item = std::pair<const K, Entry>; // элемент unordered_map
+
+  struct Entry {
+    V value;
+    std::size_t weight;
+    Item *prev;
+    Item *next;
+  };
+  using Map = std::unordered_map<K, Entry, Hash>;
+
+  Map map;
+  Item *head;
+  Item *tail;
+  std::size_t max_entries; // 0 — без ограничения
+  std::size_t max_bytes;   // 0 — без ограничения
+  std::size_t bytes;
+  std::uint64_t hit_count;
+  std::uint64_t miss_count;
+  std::uint64_t eviction_count;
+
+  void unlink(Item *item);
+  void link_front(Item *item);
+  void remove(Item *item);
+  void evict();
+
+public:
+  explicit LRUCache(std::size_t entries, std::size_t bytes_limit = 0);
+
+  LRUCache(const LRUCache &) = delete;
+  LRUCache &operator=(const LRUCache &) = delete;
+
+  // Значение по ключу (nullptr при промахе); запись становится самой
+  // свежей. Указатель действителен до удаления записи.
+  V *get(const K &key);
+  // Вставка или замена; false, если запись тяжелее max_bytes
+  bool put(const K &key, V value);
+  bool erase(const K &key);
+  bool contains(const K &key) const; // без учёта в статистике и порядке
+  void clear();
+
+  std::size_t get_size() const { return map.size(); }
+  std::size_t get_bytes() const { return bytes; }
+  std::size_t get_max_entries() const { return max_entries; }
+  std::size_t get_max_bytes() const { return max_bytes; }
+  void set_limits(std::size_t entries, std::size_t bytes_limit);
+
+  std::uint64_t hits() const { return hit_count; }
+  std::uint64_t misses() const { return miss_count; }
+  std::uint64_t evictions() const { return eviction_count; }
+  void reset_stats();
+};
+
+// Конструктор
+template <typename K, typename V, typename Hash, typename Weigher>
+LRUCache<K, V, Hash, Weigher>::LRUCache(std::size_t entries,
+                                        std::size_t bytes_limit)
+    : head(nullptr), tail(nullptr), max_entries(entries),
+      max_bytes(bytes_limit), bytes(0), hit_count(0), miss_count(0),
+      eviction_count(0) {
+  if (max_entries)
+    map.reserve(max_entries);
+}
+
+// Вырезать запись из списка
+template <typename K, typename V, typename Hash, typename Weigher>
+void LRUCache<K, V, Hash, Weigher>::unlink(Item *item) {
+  Entry &e = item->second;
+  if (e.prev)
+    e.prev->second.next = e.next;
+  else
+    head = e.next;
+  if (e.next)
+    e.next->second.prev = e.prev;
+  else
+    tail = e.prev;
+}
+
+// Поставить запись в голову списка
+template <typename K, typename V, typename Hash, typename Weigher>
+void LRUCache<K, V, Hash, Weigher>::link_front(Item *item) {
+  item->second.prev = nullptr;
+  item->second.next = head;
+  if (head)
+    head->second.prev = item;
+  else
+    tail = item;
+  head = item;
+}
+
+// Удалить запись из списка и таблицы
+template <typename K, typename V, typename Hash, typename Weigher>
+void LRUCache<K, V, Hash, Weigher>::remove(Item *item) {
+  unlink(item);
+  bytes -= item->second.weight;
+  map.erase(map.find(item->first)); // ключ не передаётся ссылкой в свой же узел
+}
+
+// Вытеснять самые старые записи, пока не соблюдены оба лимита
+template <typename K, typename V, typename Hash, typename Weigher>
+void LRUCache<K, V, Hash, Weigher>::evict() {
+  while (tail && ((max_entries && map.size() > max_entries) ||
+                  (max_bytes && bytes > max_bytes))) {
+    remove(tail);
+    ++eviction_count;
+  }
+}
+
+template <typename K, typename V, typename Hash, typename Weigher>
+V *LRUCache<K, V, Hash, Weigher>::get(const K &key) {
+  auto it = map.find(key);
+  if (it == map.end()) {
+    ++miss_count;
+    return nullptr;
+  }
+  ++hit_count;
+  Item *item = &*it;
+  if (item != head) {
+    unlink(item);
+    link_front(item);
+  }
+  return &item->second.value;
+}
+
+template <typename K, typename V, typename Hash, typename Weigher>
+bool LRUCache<K, V, Hash, Weigher>::put(const K &key, V value) {
+  std::size_t weight = Weigher()(key) + Weigher()(value);
+  if (max_bytes && weight > max_bytes) {
+    erase(key); // старое значение устарело
+    return false;
+  }
+
+  auto it = map.find(key);
+  if (it != map.end()) {
+    Item *item = &*it;
+    bytes = bytes - item->second.weight + weight;
+    item->second.value = std::move(value);
+    item->second.weight = weight;
+    if (item != head) {
+      unlink(item);
+      link_front(item);
+    }
+  } else {
+    auto res = map.emplace(key, Entry{std::move(value), weight, nullptr, nullptr});
+    bytes += weight;
+    link_front(&*res.first);
+  }
+  evict();
+  return true;
+}
+
+template <typename K, typename V, typename Hash, typename Weigher>
+bool LRUCache<K, V, Hash, Weigher>::erase(const K &key) {
+  auto it = map.find(key);
+  if (it == map.end())
+    return false;
+  remove(&*it);
+  return true;
+}
+
+template <typename K, typename V, typename Hash, typename Weigher>
+bool LRUCache<K, V, Hash, Weigher>::contains(const K &key) const {
+  return map.find(key) != map.end();
+}
+
+template <typename K, typename V, typename Hash, typename Weigher>
+void LRUCache<K, V, Hash, Weigher>::clear() {
+  map.clear();
+  head = tail = nullptr;
+  bytes = 0;
+}
+
+// Новые лимиты; лишние записи вытесняются сразу
+template <typename K, typename V, typename Hash, typename Weigher>
+void LRUCache<K, V, Hash, Weigher>::set_limits(std::size_t entries,
+                                               std::size_t bytes_limit) {
+  max_entries = entries;
+  max_bytes = bytes_limit;
+  evict();
+}
+
+template <typename K, typename V, typename Hash, typename Weigher>
+void LRUCache<K, V, Hash, Weigher>::reset_stats() {
+  hit_count = miss_count = eviction_count = 0;
+}
@@ -0,0 +1,240 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Позиционный индекс — скип-лист над готовой цепочкой узлов. Нижний
+// уровень — сама цепочка (поле next узла), над ней «экспресс-полосы» из
+// башен с длинами прыжков (span). Поиск позиции спускается по полосам,
+// затем доходит по цепочке в среднем за 1/P шагов. Вставка и удаление по
+// известной позиции — O(log n) в среднем. Полосы связаны в обе стороны, и
+// позиция узла (rank_of) находится обратным ходом от ближайшей башни
+// слева, тоже за O(log n); для этого у узла должно быть поле prev.
+template <typename Node> class SkipIndex {
+private:
+  static constexpr int MAX_LEVEL = 24;
+  static constexpr std::uint32_t P_INV = 4; // башня растёт с вероятностью 1/4
+
+  struct Tower;
+  struct Link {
+    Tower *next;
+    Tower *prev; // предыдущая башня этого уровня (голова — для первой)
+    int span;    // расстояние в позициях до next (до конца, если next пуст)
+  };
+  struct Tower {
+    Node *node;
+    std::vector<Link> links;
+  };
+
+  Tower head; // позиция -1
+  int levels;
+  int count;
+  std::uint32_t seed;
+  std::unordered_map<const Node *, Tower *> tower_of; // узлы с башнями
+
+  int random_height();
+  // Для каждого уровня — последняя башня с позицией < rank и её позиция
+  void find_path(int rank, Tower **update, int *pos);
+  int tower_rank(const Tower *t) const;
+  void free_towers();
+
+public:
+  SkipIndex() : levels(0), count(0), seed(2463534242u) {
+    head.node = nullptr;
+    head.links.assign(MAX_LEVEL, Link{nullptr, nullptr, 0});
+  }
+  ~SkipIndex() { free_towers(); }
+
+  SkipIndex(const SkipIndex &) = delete;
+  SkipIndex &operator=(const SkipIndex &) = delete;
+
+  int size() const { return count; }
+  void clear();
+  void rebuild(Node *first); // по цепочке next от first
+  void insert(int rank, Node *node); // node уже стоит в цепочке на позиции rank
+  void erase(int rank);              // вызывать до удаления узла из цепочки
+  Node *at(int rank, Node *first) const;
+  int rank_of(const Node *node) const; // node стоит в проиндексированной цепочке
+  std::size_t memory_usage() const;
+};
+
+// Высота башни: 0 — узел остаётся только в цепочке
+template <typename Node> int SkipIndex<Node>::random_height() {
+  int h = 0;
+  for (;;) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    if (seed % P_INV != 0 || h == MAX_LEVEL)
+      return h;
+    ++h;
+  }
+}
+
+template <typename Node> void SkipIndex<Node>::free_towers() {
+  Tower *t = head.links[0].next;
+  while (t) {
+    Tower *next = t->links[0].next;
+    delete t;
+    t = next;
+  }
+}
+
+template <typename Node> void SkipIndex<Node>::clear() {
+  free_towers();
+  head.links.assign(MAX_LEVEL, Link{nullptr, nullptr, 0});
+  tower_of.clear();
+  levels = 0;
+  count = 0;
+}
+
+template <typename Node> void SkipIndex<Node>::rebuild(Node *first) {
+  clear();
+  Tower *last[MAX_LEVEL];
+  int last_pos[MAX_LEVEL];
+  for (int l = 0; l < MAX_LEVEL; ++l) {
+    last[l] = &head;
+    last_pos[l] = -1;
+  }
+  for (Node *n = first; n; n = n->next, ++count) {
+    int h = random_height();
+    if (h == 0)
+      continue;
+    Tower *t = new Tower{n, std::vector<Link>(h, Link{nullptr, nullptr, 0})};
+    tower_of.emplace(n, t);
+    for (int l = 0; l < h; ++l) {
+      last[l]->links[l].next = t;
+      last[l]->links[l].span = count - last_pos[l];
+      t->links[l].prev = last[l];
+      last[l] = t;
+      last_pos[l] = count;
+    }
+    if (h > levels)
+      levels = h;
+  }
+  for (int l = 0; l < levels; ++l)
+    last[l]->links[l].span = count - last_pos[l];
+}
+
+template <typename Node>
+void SkipIndex<Node>::find_path(int rank, Tower **update, int *pos) {
+  Tower *x = &head;
+  int p = -1;
+  for (int l = levels - 1; l >= 0; --l) {
+    while (x->links[l].next && p + x->links[l].span < rank) {
+      p += x->links[l].span;
+      x = x->links[l].next;
+    }
+    update[l] = x;
+    pos[l] = p;
+  }
+}
+
+template <typename Node> void SkipIndex<Node>::insert(int rank, Node *node) {
+  Tower *update[MAX_LEVEL];
+  int pos[MAX_LEVEL];
+  int h = random_height();
+  if (h > levels) { // новый уровень: от головы (позиция -1) до конца
+    for (int l = levels; l < h; ++l)
+      head.links[l] = Link{nullptr, nullptr, count + 1};
+    levels = h;
+  }
+  find_path(rank, update, pos);
+  Tower *t = h ? new Tower{node, std::vector<Link>(h)} : nullptr;
+  if (t)
+    tower_of.emplace(node, t);
+  for (int l = 0; l < levels; ++l) {
+    Link &link = update[l]->links[l];
+    if (l < h) {
+      t->links[l] = Link{link.next, update[l], link.span + 1 - (rank - pos[l])};
+      if (link.next)
+        link.next->links[l].prev = t;
+      link.next = t;
+      link.span = rank - pos[l];
+    } else {
+      link.span += 1;
+    }
+  }
+  ++count;
+}
+
+template <typename Node> void SkipIndex<Node>::erase(int rank) {
+  Tower *update[MAX_LEVEL];
+  int pos[MAX_LEVEL];
+  find_path(rank, update, pos);
+  Tower *victim = nullptr;
+  for (int l = 0; l < levels; ++l) {
+    Link &link = update[l]->links[l];
+    if (link.next && pos[l] + link.span == rank) {
+      victim = link.next;
+      link.next = victim->links[l].next;
+      link.span += victim->links[l].span - 1;
+      if (link.next)
+        link.next->links[l].prev = update[l];
+    } else {
+      link.span -= 1;
+    }
+  }
+  if (victim) {
+    tower_of.erase(victim->node);
+    delete victim;
+  }
+  while (levels > 0 && !head.links[levels - 1].next)
+    --levels;
+  --count;
+}
+
+// Узел на позиции rank: спуск по полосам, затем шаги по цепочке
+template <typename Node>
+Node *SkipIndex<Node>::at(int rank, Node *first) const {
+  if (rank < 0 || rank >= count)
+    return nullptr;
+  const Tower *x = &head;
+  int p = -1;
+  for (int l = levels - 1; l >= 0; --l) {
+    while (x->links[l].next && p + x->links[l].span <= rank) {
+      p += x->links[l].span;
+      x = x->links[l].next;
+    }
+  }
+  Node *n = x == &head ? first : x->node;
+  for (int i = x == &head ? 0 : p; i < rank; ++i)
+    n = n->next;
+  return n;
+}
+
+// Позиция башни: обратный ход по верхним уровням до головы
+template <typename Node>
+int SkipIndex<Node>::tower_rank(const Tower *t) const {
+  int p = -1;
+  while (t != &head) {
+    const Link &top = t->links.back();
+    p += top.prev->links[t->links.size() - 1].span;
+    t = top.prev;
+  }
+  return p;
+}
+
+// Позиция узла: по prev до первой башни (в среднем 1/P шагов), затем
+// обратный ход по полосам
+template <typename Node>
+int SkipIndex<Node>::rank_of(const Node *node) const {
+  int steps = 0;
+  for (const Node *n = node; n; n = n->prev, ++steps) {
+    auto it = tower_of.find(n);
+    if (it != tower_of.end())
+      return tower_rank(it->second) + steps;
+  }
+  return steps - 1; // дошли до головы цепочки
+}
+
+template <typename Node> std::size_t SkipIndex<Node>::memory_usage() const {
+  std::size_t bytes = sizeof(*this) + head.links.capacity() * sizeof(Link);
+  for (const Tower *t = head.links[0].next; t; t = t->links[0].next)
+    bytes += sizeof(Tower) + t->links.capacity() * sizeof(Link);
+  // Узел unordered_map: ключ, значение, указатель next и кэш хэша
+  bytes += tower_of.bucket_count() * sizeof(void *) +
+           tower_of.size() * 4 * sizeof(void *);
+  return bytes;
+}
@@ -1,17 +1,20 @@
 #include "list.hpp"
 #include <iostream>
 #include <string>
+#include <new>
 
 using namespace std;
 
-List::List() : head(nullptr), tail(nullptr) {}
+List::List()
+    : head(nullptr), tail(nullptr), indexed(false),
+      find_mode(FindMode::Plain) {}
 
 List::~List() {
   LNode *cur = head;
   while (cur) {
     LNode *tmp = cur;
     cur = cur->next;
-    delete tmp;
+    free_node(tmp);
   }
 }
 
@@ -27,25 +30,219 @@ int List::get_size() const {
   return count;
 }
 
-List::LNode *List::find(const std::string &key) const {
+// Поиск первого вхождения вместе с предшественником
+bool List::locate(const string &key, LNode *&prev, LNode *&cur) const {
+  if (indexed) {
+    auto it = index.find(key);
+    if (it == index.end())
+      return false;
+    IndexEntry &e = it->second;
+    if (e.stale) {
+      LNode *p = nullptr;
+      LNode *c = head;
+      while (c && c->data != key) {
+        p = c;
+        c = c->next;
+      }
+      if (!c) { // запись пережила свой ключ — убрать, а не разыменовывать
+        index.erase(it);
+        return false;
+      }
+      e.node = c;
+      e.prev = p;
+      e.stale = false;
+    }
+    prev = e.prev;
+    cur = e.node;
+    return true;
+  }
+
+  prev = nullptr;
+  cur = head;
+  while (cur && cur->data != key) {
+    prev = cur;
+    cur = cur->next;
+  }
+  return cur != nullptr;
+}
+
+// Предшественник узла: из индекса, если узел — первое вхождение своего ключа
+List::LNode *List::predecessor(LNode *node) const {
+  if (indexed) {
+    auto it = index.find(node->data);
+    if (it != index.end() && !it->second.stale && it->second.node == node)
+      return it->second.prev;
+  }
+  LNode *prev = nullptr;
   LNode *cur = head;
-  while (cur) {
-    if (cur->data == key)
-      return cur;
+  while (cur != node) {
+    prev = cur;
+    cur = cur->next;
+  }
+  return prev;
+}
+
+// Учёт нового узла; front — узел гарантированно встал перед всеми
+// прежними вхождениями, иначе при дубликате запись устаревает
+void List::index_add(LNode *node, LNode *prev, bool front) {
+  if (!indexed)
+    return;
+  auto res = index.emplace(node->data, IndexEntry{node, prev, 1, false});
+  if (res.second)
+    return;
+  IndexEntry &e = res.first->second;
+  e.count += 1;
+  if (front) {
+    e.node = node;
+    e.prev = prev;
+    e.stale = false;
+  } else if (node != tail) {
+    e.stale = true; // push_back не меняет первое вхождение
+  }
+}
+
+// Учёт удаляемого узла (вызывается до delete)
+void List::index_remove(LNode *node) {
+  if (!indexed)
+    return;
+  auto it = index.find(node->data);
+  if (it == index.end())
+    return;
+  if (--it->second.count == 0)
+    index.erase(it);
+  else if (it->second.node == node)
+    it->second.stale = true;
+}
+
+// У узла сменился предшественник
+void List::index_relink(LNode *node, LNode *prev) {
+  if (!indexed || !node)
+    return;
+  auto it = index.find(node->data);
+  if (it != index.end() && !it->second.stale && it->second.node == node)
+    it->second.prev = prev;
+}
+
+void List::rebuild_index() {
+  index.clear();
+  LNode *prev = nullptr;
+  for (LNode *cur = head; cur; cur = cur->next) {
+    auto res = index.emplace(cur->data, IndexEntry{cur, prev, 1, false});
+    if (!res.second)
+      res.first->second.count += 1;
+    prev = cur;
+  }
+}
+
+void List::enable_index() {
+  indexed = true;
+  rebuild_index();
+}
+
+void List::disable_index() {
+  indexed = false;
+  index.clear();
+  index.rehash(0);
+}
+
+bool List::is_indexed() const { return indexed; }
+
+size_t List::index_memory_usage() const {
+  if (!indexed)
+    return 0;
+  // Узел unordered_map: значение, указатель next и кэш хэша
+  size_t bytes = index.bucket_count() * sizeof(void *);
+  bytes += index.size() * (sizeof(decltype(index)::value_type) +
+                           sizeof(void *) + sizeof(size_t));
+  for (const auto &kv : index) {
+    if (kv.first.capacity() > 15) // строка вне SSO-буфера
+      bytes += kv.first.capacity() + 1;
+  }
+  return bytes;
+}
+
+const List::LNode *List::find(const std::string &key) const {
+  LNode *prev, *cur;
+  if (!locate(key, prev, cur))
+    return nullptr;
+  return cur;
+}
+
+// Поиск с самоорганизацией
+const List::LNode *List::find(const std::string &key) {
+  if (find_mode == FindMode::Plain || indexed) {
+    LNode *prev, *cur;
+    if (!locate(key, prev, cur))
+      return nullptr;
+    if (find_mode == FindMode::MoveToFront)
+      move_to_front(prev, cur);
+    else if (find_mode == FindMode::Transpose && prev)
+      transpose(predecessor(prev), prev, cur);
+    return cur;
+  }
+
+  // Без индекса предшественники собираются в том же проходе
+  LNode *prev2 = nullptr;
+  LNode *prev = nullptr;
+  LNode *cur = head;
+  while (cur && cur->data != key) {
+    prev2 = prev;
+    prev = cur;
     cur = cur->next;
   }
-  return nullptr;
+  if (!cur)
+    return nullptr;
+  if (find_mode == FindMode::MoveToFront)
+    move_to_front(prev, cur);
+  else if (prev)
+    transpose(prev2, prev, cur);
+  return cur;
+}
+
+void List::set_find_mode(FindMode mode) { find_mode = mode; }
+
+List::FindMode List::get_find_mode() const { return find_mode; }
+
+// Перенести cur (предшественник prev) в голову
+void List::move_to_front(LNode *prev, LNode *cur) {
+  if (!prev)
+    return;
+  prev->next = cur->next;
+  if (cur == tail)
+    tail = prev;
+  index_relink(prev->next, prev);
+  cur->next = head;
+  index_relink(head, cur);
+  head = cur;
+  index_relink(cur, nullptr);
+}
+
+// Поменять cur местами с предшественником prev (перед ним — prev2)
+void List::transpose(LNode *prev2, LNode *prev, LNode *cur) {
+  prev->next = cur->next;
+  cur->next = prev;
+  if (prev2)
+    prev2->next = cur;
+  else
+    head = cur;
+  if (cur == tail)
+    tail = prev;
+  index_relink(cur, prev2);
+  index_relink(prev, cur);
+  index_relink(prev->next, prev);
 }
 
 // Добавление в конец
 void List::push_back(const string &val) {
   LNode *node = new LNode(val);
+  LNode *prev = tail;
   if (is_empty()) {
     head = tail = node;
   } else {
     tail->next = node;
     tail = node;
   }
+  index_add(node, prev, false);
 }
 
 // Добавление в начало
@@ -55,12 +252,15 @@ void List::push_front(const string &val) {
   head = node;
   if (!tail)
     tail = node;
+  index_relink(node->next, node);
+  index_add(node, nullptr, true);
 }
 
 // Вставка после заданного ключа
 void List::insert_after(const string &key, const string &val) {
-  LNode *cur = find(key);
-  if (!cur) {
+  LNode *prev = nullptr;
+  LNode *cur = nullptr;
+  if (!locate(key, prev, cur)) {
     cout << "Элемент '" << key << "' не найден.\n";
     return;
   }
@@ -70,6 +270,8 @@ void List::insert_after(const string &key, const string &val) {
   cur->next = node;
   if (cur == tail)
     tail = node;
+  index_relink(node->next, node);
+  index_add(node, cur, false);
 }
 
 // Вставка перед заданным ключом
@@ -83,14 +285,8 @@ void List::insert_before(const string &key, const string &val) {
   }
 
   LNode *prev = nullptr;
-  LNode *cur = head;
-
-  while (cur && cur->data != key) {
-    prev = cur;
-    cur = cur->next;
-  }
-
-  if (!cur) {
+  LNode *cur = nullptr;
+  if (!locate(key, prev, cur)) {
     cout << "Элемент '" << key << "' не найден.\n";
     return;
   }
@@ -98,6 +294,8 @@ void List::insert_before(const string &key, const string &val) {
   LNode *node = new LNode(val);
   node->next = cur;
   prev->next = node;
+  index_relink(cur, node);
+  index_add(node, prev, false);
 }
 
 // Удаление по значению
@@ -111,14 +309,8 @@ void List::del(const string &val) {
   }
 
   LNode *prev = nullptr;
-  LNode *cur = head;
-
-  while (cur && cur->data != val) {
-    prev = cur;
-    cur = cur->next;
-  }
-
-  if (!cur) {
+  LNode *cur = nullptr;
+  if (!locate(val, prev, cur)) {
     cout << "Элемент '" << val << "' не найден.\n";
     return;
   }
@@ -126,7 +318,9 @@ void List::del(const string &val) {
   prev->next = cur->next;
   if (cur == tail)
     tail = prev;
-  delete cur;
+  index_relink(cur->next, prev);
+  index_remove(cur);
+  free_node(cur);
 }
 
 // Вывод списка
@@ -140,7 +334,7 @@ void List::print() const {
 }
 
 // Получить элемент по индексу
-List::LNode *List::get_at(int index) const {
+const List::LNode *List::get_at(int index) const {
   if (index < 0)
     return nullptr;
   LNode *cur = head;
@@ -152,6 +346,23 @@ List::LNode *List::get_at(int index) const {
   return cur;
 }
 
+// Замена значения по индексу: узел остаётся на месте, меняется ключ
+void List::replace_at(int index, const string &val) {
+  if (index < 0)
+    return;
+  LNode *prev = nullptr;
+  LNode *cur = head;
+  for (int i = 0; cur && i < index; ++i) {
+    prev = cur;
+    cur = cur->next;
+  }
+  if (!cur)
+    return;
+  index_remove(cur);
+  cur->data = val;
+  index_add(cur, prev, false);
+}
+
 // Удаление головы
 void List::del_head() {
   if (is_empty())
@@ -159,7 +370,9 @@ void List::del_head() {
 
   LNode *tmp = head;
   head = head->next;
-  delete tmp;
+  index_relink(head, nullptr);
+  index_remove(tmp);
+  free_node(tmp);
 
   if (!head)
     tail = nullptr;
@@ -171,7 +384,8 @@ void List::del_tail() {
     return;
 
   if (head == tail) {
-    delete head;
+    index_remove(head);
+    free_node(head);
     head = tail = nullptr;
     return;
   }
@@ -180,22 +394,26 @@ void List::del_tail() {
   while (cur->next != tail)
     cur = cur->next;
 
-  delete tail;
+  index_remove(tail);
+  free_node(tail);
   tail = cur;
   tail->next = nullptr;
 }
 
 // Удалить элемент после ключа
 void List::del_after(const string &key) {
-  LNode *cur = find(key);
-  if (!cur || !cur->next)
+  LNode *prev = nullptr;
+  LNode *cur = nullptr;
+  if (!locate(key, prev, cur) || !cur->next)
     return;
 
   LNode *tmp = cur->next;
   cur->next = tmp->next;
   if (tmp == tail)
     tail = cur;
-  delete tmp;
+  index_relink(cur->next, cur);
+  index_remove(tmp);
+  free_node(tmp);
 }
 
 // Удалить элемент перед ключом
@@ -208,21 +426,146 @@ void List::del_before(const string &key) {
     return;
   }
 
-  LNode *prevPrev = nullptr;
-  LNode *prev = head;
-  LNode *cur = head->next;
+  LNode *prev = nullptr;
+  LNode *cur = nullptr;
+  if (!locate(key, prev, cur))
+    return; // не найден ключ
 
-  while (cur && cur->data != key) {
-    prevPrev = prev;
-    prev = cur;
+  LNode *prevPrev = predecessor(prev);
+  prevPrev->next = cur;
+  index_relink(cur, prevPrev);
+  index_remove(prev);
+  free_node(prev);
+}
+
+// Вставить цепочку first..last после pos (nullptr — в начало)
+void List::link_after(LNode *pos, LNode *first, LNode *last) {
+  if (!pos) {
+    last->next = head;
+    head = first;
+    if (!tail)
+      tail = last;
+  } else {
+    last->next = pos->next;
+    pos->next = first;
+    if (pos == tail)
+      tail = last;
+  }
+}
+
+// Перенос всех узлов other после pos
+void List::splice(const LNode *pos, List &other) {
+  if (&other == this || other.is_empty())
+    return;
+  LNode *first = other.head;
+  LNode *last = other.tail;
+  other.head = other.tail = nullptr;
+  other.index.clear();
+  link_after(const_cast<LNode *>(pos), first, last);
+  slabs.share(other.slabs);
+  if (indexed)
+    rebuild_index();
+}
+
+// Перенос узлов (before_first, last] из other после pos
+void List::splice_range(const LNode *pos, List &other,
+                        const LNode *before_first, const LNode *last_node) {
+  // Узлы принадлежат спискам, которые меняются здесь же
+  LNode *before = const_cast<LNode *>(before_first);
+  LNode *last = const_cast<LNode *>(last_node);
+  LNode *first = before ? before->next : other.head;
+  if (!first || !last)
+    return;
+  if (before)
+    before->next = last->next;
+  else
+    other.head = last->next;
+  if (other.tail == last)
+    other.tail = before;
+  link_after(const_cast<LNode *>(pos), first, last);
+  if (&other != this)
+    slabs.share(other.slabs);
+  if (other.indexed && &other != this)
+    other.rebuild_index();
+  if (indexed)
+    rebuild_index();
+}
+
+// Присоединить other в конец
+void List::concat(List &other) { splice(tail, other); }
+
+// Отделить хвост начиная с index в конец rest
+void List::split_at(int index, List &rest) {
+  if (&rest == this || is_empty())
+    return;
+  if (index <= 0) {
+    rest.concat(*this);
+    return;
+  }
+  const LNode *before = get_at(index - 1);
+  if (!before || !before->next)
+    return;
+  rest.splice_range(rest.tail, *this, before, tail);
+}
+
+// Освободить узел: из блока compact() — на месте, иначе delete
+size_t List::free_node(LNode *node) {
+  size_t released = 0;
+  node->~LNode();
+  if (!slabs.release(node, released)) {
+    ::operator delete(node);
+    released = node_chain::heap_chunk(sizeof(LNode));
+  }
+  return released;
+}
+
+// Переложить узлы подряд в один блок в порядке обхода
+size_t List::compact() {
+  size_t count = static_cast<size_t>(get_size());
+  if (count == 0)
+    return 0;
+
+  char *block = static_cast<char *>(::operator new(count * sizeof(LNode)));
+  LNode *nodes = reinterpret_cast<LNode *>(block);
+  size_t before = 0;
+  size_t after = count * sizeof(LNode);
+  LNode *cur = head;
+  for (size_t i = 0; i < count; ++i) {
+    before += cur->data.capacity();
+    new (&nodes[i]) LNode(std::move(cur->data));
+    nodes[i].data.shrink_to_fit();
+    after += nodes[i].data.capacity();
+    nodes[i].next = i + 1 < count ? &nodes[i + 1] : nullptr;
+    LNode *old = cur;
     cur = cur->next;
+    before += free_node(old);
   }
+  slabs.add(block, count * sizeof(LNode), count);
+  head = &nodes[0];
+  tail = &nodes[count - 1];
+  if (indexed)
+    rebuild_index();
+  return before > after ? before - after : 0;
+}
 
-  if (!cur)
-    return; // не найден ключ
+// Сортировка по возрастанию перевязкой узлов
+void List::sort() {
+  head = node_chain::merge_sort(head, get_size());
+  tail = head;
+  while (tail && tail->next)
+    tail = tail->next;
+  if (indexed)
+    rebuild_index();
+}
 
-  prevPrev->next = cur;
-  delete prev;
+// Многопоточная сортировка по возрастанию
+void List::parallel_sort(int threads) {
+  head = node_chain::parallel_merge_sort(head, get_size(), threads);
+  tail = head;
+  while (tail && tail->next)
+    tail = tail->next;
+  if (indexed)
+    rebuild_index();
 }
 
 // Текстовая сериализация
@@ -248,9 +591,10 @@ void List::deserialize(std::istream &in) {
   while (cur) {
     LNode *tmp = cur;
     cur = cur->next;
-    delete tmp;
+    free_node(tmp);
   }
   head = tail = nullptr;
+  index.clear();
 
   // Загружаем элементы
   for (int i = 0; i < size; ++i) {
@@ -258,4 +602,4 @@ void List::deserialize(std::istream &in) {
     std::getline(in, val);
     push_back(val);
   }
-}
\ No newline at end of file
+}
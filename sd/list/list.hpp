@@ -1,20 +1,80 @@
 #ifndef LIST_H
 #define LIST_H
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <string>
+#include <unordered_map>
+
+#include "node_chain.hpp"
 
 class List {
+public:
+  // Режим поиска: найденный узел остаётся на месте, переносится в
+  // голову или меняется местами с предыдущим
+  enum class FindMode { Plain, MoveToFront, Transpose };
+
 private:
   struct LNode {
     std::string data;
     LNode *next;
     LNode(const std::string &val) : data(val), next(nullptr) {}
+    LNode(std::string &&val) : data(std::move(val)), next(nullptr) {}
   };
   LNode *head;
   LNode *tail;
+  node_chain::SlabSet slabs; // блоки compact(), из которых могут быть узлы
+
+  // Необязательный индекс ключ -> первое вхождение и его предшественник.
+  // count — число узлов с этим ключом; stale выставляется, когда первое
+  // вхождение могло смениться (дубликат вставлен в середину или удалено
+  // первое вхождение), и запись восстанавливается проходом при обращении.
+  struct IndexEntry {
+    LNode *node;
+    LNode *prev;
+    int count;
+    bool stale;
+  };
+  mutable std::unordered_map<std::string, IndexEntry> index;
+  bool indexed;
+  FindMode find_mode;
+
+  // Первое вхождение key и его предшественник (nullptr для головы)
+  bool locate(const std::string &key, LNode *&prev, LNode *&cur) const;
+  LNode *predecessor(LNode *node) const;
+  void index_add(LNode *node, LNode *prev, bool front);
+  void index_remove(LNode *node);
+  void index_relink(LNode *node, LNode *prev);
+  void rebuild_index();
+  void link_after(LNode *pos, LNode *first, LNode *last);
+  std::size_t free_node(LNode *node); // возвращает освобождённые байты (оценка)
+  void move_to_front(LNode *prev, LNode *cur);
+  void transpose(LNode *prev2, LNode *prev, LNode *cur);
 
 public:
+  // Прямой итератор только для чтения: изменение строк через итератор
+  // рассогласовало бы индекс ключей, поэтому iterator == const_iterator
+  class const_iterator {
+    const LNode *node;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string *;
+    using reference = const std::string &;
+
+    const_iterator(const LNode *n = nullptr) : node(n) {}
+    reference operator*() const { return node->data; }
+    pointer operator->() const { return &node->data; }
+    const_iterator &operator++() { node = node->next; return *this; }
+    const_iterator operator++(int) { const_iterator t = *this; node = node->next; return t; }
+    bool operator==(const const_iterator &o) const { return node == o.node; }
+    bool operator!=(const const_iterator &o) const { return node != o.node; }
+  };
+  using iterator = const_iterator;
+
   List();
   ~List();
 
@@ -24,19 +84,66 @@ public:
   bool is_empty() const;
   int get_size() const;
 
-  LNode *find(const std::string &key) const;
+  // Неконстантный find в режимах MoveToFront и Transpose переставляет
+  // найденный узел, так что частые ключи со временем оказываются у головы.
+  // Константный find и поиск внутри insert_*/del_* порядок не меняют.
+  // Узлы отдаются только для чтения, как и через итераторы: строку
+  // меняет replace_at, который правит и индекс ключей.
+  const LNode *find(const std::string &key);
+  const LNode *find(const std::string &key) const;
+  void set_find_mode(FindMode mode);
+  FindMode get_find_mode() const;
   void push_back(const std::string &val);
   void insert_after(const std::string &key, const std::string &val);
   void push_front(const std::string &val);
   void insert_before(const std::string &key, const std::string &val);
   void del(const std::string &val);
   void print() const;
-  LNode *get_at(int index) const;
+  const LNode *get_at(int index) const;
+  void replace_at(int index, const std::string &val); // O(index)
   void del_tail();
   void del_head();
   void del_after(const std::string &key);
   void del_before(const std::string &key);
 
+  // Перенос узлов между списками перевязкой указателей, без копирования
+  // строк. pos — узел этого списка (find/get_at), вставка идёт после
+  // него, nullptr — в начало. splice_range переносит узлы после
+  // before_first (nullptr — с головы other) по last включительно.
+  // Все операции O(1); при включённом индексе он перестраивается за O(n).
+  void splice(const LNode *pos, List &other);
+  void splice_range(const LNode *pos, List &other, const LNode *before_first,
+                    const LNode *last);
+  void concat(List &other);
+  // Перенести элементы с позиции index до конца в конец rest: O(index)
+  void split_at(int index, List &rest);
+
+  // Дефрагментация: узлы переезжают в один блок в порядке обхода, лишняя
+  // ёмкость строк отдаётся. Возвращает оценку, а не замер: ёмкость
+  // строк плюс старые узлы по модели glibc malloc (служебное слово,
+  // выравнивание до 16 байт, не меньше 32) за вычетом нового блока.
+  // Указатели на узлы и итераторы после вызова недействительны.
+  std::size_t compact();
+
+  // Устойчивая сортировка слиянием снизу вверх: узлы перевязываются на
+  // месте, без выделения памяти. parallel_sort сортирует куски списка
+  // в отдельных потоках и сливает их попарно (threads = 0 — по числу ядер).
+  void sort();
+  void parallel_sort(int threads = 0);
+
+  // Индекс по ключам: find, insert_after, insert_before, del, del_after и
+  // del_before работают за O(1) в среднем. Для повторяющихся ключей
+  // операции, как и без индекса, адресуют первое вхождение.
+  void enable_index();
+  void disable_index();
+  bool is_indexed() const;
+  std::size_t index_memory_usage() const; // оценка в байтах
+
+  const_iterator begin() const { return const_iterator(head); }
+  const_iterator end() const { return const_iterator(); }
+  const_iterator cbegin() const { return const_iterator(head); }
+  const_iterator cend() const { return const_iterator(); }
+
   // Текстовая сериализация и десериализация
   void serialize(std::ostream &out) const;
   void deserialize(std::istream &in);
@@ -0,0 +1,193 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+// Общие для List и DoublyList операции над цепочками узлов, связанных
+// полем next: сортировка слиянием снизу вверх и её параллельный вариант,
+// а также учёт блоков узлов, выделенных compact().
+namespace node_chain {
+
+// Меньше этого числа узлов на поток параллельная сортировка не выгодна
+constexpr int PARALLEL_SORT_MIN = 4096;
+
+// Отрезать цепочку после count узлов, вернуть начало остатка
+template <typename Node> Node *cut_after(Node *first, int count) {
+  for (int i = 1; first && i < count; ++i)
+    first = first->next;
+  if (!first)
+    return nullptr;
+  Node *rest = first->next;
+  first->next = nullptr;
+  return rest;
+}
+
+// Устойчивое слияние двух цепочек в *out; возвращает поле next
+// последнего узла результата
+template <typename Node> Node **merge_into(Node **out, Node *a, Node *b) {
+  while (a && b) {
+    if (b->data < a->data) {
+      *out = b;
+      b = b->next;
+    } else {
+      *out = a;
+      a = a->next;
+    }
+    out = &(*out)->next;
+  }
+  *out = a ? a : b;
+  while (*out)
+    out = &(*out)->next;
+  return out;
+}
+
+// Сортировка цепочки из count узлов слиянием серий длины 1, 2, 4, ...
+template <typename Node> Node *merge_sort(Node *first, int count) {
+  for (int width = 1; width < count; width *= 2) {
+    Node *result = nullptr;
+    Node **out = &result;
+    Node *cur = first;
+    while (cur) {
+      Node *left = cur;
+      Node *right = cut_after(left, width);
+      cur = cut_after(right, width);
+      out = merge_into(out, left, right);
+    }
+    first = result;
+  }
+  return first;
+}
+
+// Параллельная сортировка цепочки: куски сортируются в своих потоках,
+// затем сливаются попарно, уровни слияния тоже параллельны
+template <typename Node>
+Node *parallel_merge_sort(Node *first, int count, int threads) {
+  if (threads <= 0)
+    threads = static_cast<int>(std::thread::hardware_concurrency());
+  if (threads > count / (PARALLEL_SORT_MIN / 2))
+    threads = count / (PARALLEL_SORT_MIN / 2);
+  if (threads <= 1)
+    return merge_sort(first, count);
+
+  std::vector<Node *> parts(threads);
+  std::vector<int> sizes(threads);
+  for (int i = 0; i < threads; ++i) {
+    sizes[i] = static_cast<int>(static_cast<long long>(count) * (i + 1) / threads -
+                                static_cast<long long>(count) * i / threads);
+    parts[i] = first;
+    first = cut_after(first, sizes[i]);
+  }
+
+  std::vector<std::thread> workers;
+  for (int i = 0; i < threads; ++i) {
+    workers.emplace_back(
+        [&parts, &sizes, i] { parts[i] = merge_sort(parts[i], sizes[i]); });
+  }
+  for (std::thread &t : workers)
+    t.join();
+
+  while (parts.size() > 1) {
+    std::vector<Node *> next((parts.size() + 1) / 2);
+    workers.clear();
+    for (size_t i = 0; i + 1 < parts.size(); i += 2) {
+      workers.emplace_back([&parts, &next, i] {
+        merge_into(&next[i / 2], parts[i], parts[i + 1]);
+      });
+    }
+    if (parts.size() % 2)
+      next.back() = parts.back();
+    for (std::thread &t : workers)
+      t.join();
+    parts.swap(next);
+  }
+  return parts[0];
+}
+
+// Блок узлов, выделенный compact(): узел из блока разрушается на месте,
+// а память блока отдаётся вместе с последним живым узлом. После splice
+// узлы одного блока могут жить в разных списках (и потоках), поэтому
+// счётчик живых узлов атомарный.
+struct NodeSlab {
+  char *base;
+  std::size_t bytes;
+  std::atomic<std::size_t> live;
+  NodeSlab(char *b, std::size_t n, std::size_t count)
+      : base(b), bytes(n), live(count) {}
+};
+
+// Блоки, из которых могут быть узлы списка. Набор принадлежит списку;
+// splice передаёт получателю совместное владение блоками источника.
+// Пока список не дефрагментировали, освобождение узла — одна проверка
+// на пустоту, без общих замков.
+class SlabSet {
+private:
+  std::vector<std::shared_ptr<NodeSlab>> slabs;
+
+  // Выбросить блоки, память которых уже отдана
+  void drop_dead() {
+    for (std::size_t i = 0; i < slabs.size();) {
+      if (slabs[i]->live.load(std::memory_order_acquire) == 0) {
+        slabs[i] = std::move(slabs.back());
+        slabs.pop_back();
+      } else {
+        ++i;
+      }
+    }
+  }
+
+public:
+  void add(char *base, std::size_t bytes, std::size_t live) {
+    drop_dead();
+    slabs.push_back(std::make_shared<NodeSlab>(base, bytes, live));
+  }
+
+  // Разделить владение блоками other (узлы переехали или переедут сюда)
+  void share(const SlabSet &other) {
+    if (other.slabs.empty())
+      return;
+    drop_dead();
+    for (const auto &slab : other.slabs) {
+      bool known = false;
+      for (const auto &mine : slabs)
+        known = known || mine == slab;
+      if (!known && slab->live.load(std::memory_order_acquire) > 0)
+        slabs.push_back(slab);
+    }
+  }
+
+  // Учесть освобождение узла p; false, если p не из блока. В released
+  // добавляется размер блока, если он освобождён целиком.
+  bool release(void *p, std::size_t &released) {
+    if (slabs.empty())
+      return false;
+    char *addr = static_cast<char *>(p);
+    for (std::size_t i = 0; i < slabs.size(); ++i) {
+      NodeSlab &slab = *slabs[i];
+      // Память мёртвого блока могла уйти под обычный узел
+      if (addr < slab.base || addr >= slab.base + slab.bytes ||
+          slab.live.load(std::memory_order_acquire) == 0)
+        continue;
+      if (slab.live.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        released += slab.bytes;
+        ::operator delete(slab.base);
+        slabs[i] = std::move(slabs.back());
+        slabs.pop_back();
+      }
+      return true;
+    }
+    return false;
+  }
+};
+
+// Оценка места, занимаемого отдельно выделенным узлом, по модели
+// glibc malloc: размер плюс служебное слово, выравнивание до 16 байт,
+// не меньше 32. Реальный расход зависит от распределителя.
+inline std::size_t heap_chunk(std::size_t bytes) {
+  std::size_t chunk = (bytes + sizeof(std::size_t) + 15) & ~std::size_t(15);
+  return chunk < 32 ? 32 : chunk;
+}
+
+} // namespace node_chain
@@ -0,0 +1,262 @@
+#include "unrolled_list.hpp"
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+UnrolledList::UnrolledList() : head(nullptr), tail(nullptr), size(0) {}
+
+UnrolledList::~UnrolledList() { clear(); }
+
+// Освобождение всех узлов
+void UnrolledList::clear() {
+  UNode *cur = head;
+  while (cur) {
+    UNode *tmp = cur;
+    cur = cur->next;
+    delete tmp;
+  }
+  head = tail = nullptr;
+  size = 0;
+}
+
+bool UnrolledList::is_empty() const { return head == nullptr; }
+
+int UnrolledList::get_size() const { return size; }
+
+int UnrolledList::get_node_count() const {
+  int count = 0;
+  for (UNode *cur = head; cur; cur = cur->next)
+    ++count;
+  return count;
+}
+
+size_t UnrolledList::memory_usage() const {
+  return static_cast<size_t>(get_node_count()) * sizeof(UNode);
+}
+
+// Поиск первого вхождения с запоминанием предшественников
+bool UnrolledList::locate(const string &key, UNode *&prev2, UNode *&prev,
+                          UNode *&node, int &idx) const {
+  prev2 = prev = nullptr;
+  for (node = head; node; node = node->next) {
+    for (idx = 0; idx < node->count; ++idx) {
+      if (node->items[idx] == key)
+        return true;
+    }
+    prev2 = prev;
+    prev = node;
+  }
+  return false;
+}
+
+// Вставка в узел по индексу; переполненный узел делится пополам,
+// а вставка в конец полного узла уходит в следующий узел
+void UnrolledList::insert_into(UNode *node, int idx, const string &val) {
+  string tmp(val); // val может указывать внутрь узла
+  if (node->count == NODE_CAPACITY) {
+    UNode *fresh = new UNode();
+    if (idx < NODE_CAPACITY) {
+      int half = NODE_CAPACITY / 2;
+      for (int i = half; i < NODE_CAPACITY; ++i)
+        fresh->items[i - half] = std::move(node->items[i]);
+      fresh->count = NODE_CAPACITY - half;
+      node->count = half;
+    }
+    fresh->next = node->next;
+    node->next = fresh;
+    if (tail == node)
+      tail = fresh;
+    if (idx >= node->count) {
+      idx -= node->count;
+      node = fresh;
+    }
+  }
+  for (int i = node->count; i > idx; --i)
+    node->items[i] = std::move(node->items[i - 1]);
+  node->items[idx] = std::move(tmp);
+  ++node->count;
+  ++size;
+}
+
+// Удаление элемента idx из node; пустой узел отцепляется, а малый
+// сливается со следующим
+void UnrolledList::erase_from(UNode *prev, UNode *node, int idx) {
+  for (int i = idx; i < node->count - 1; ++i)
+    node->items[i] = std::move(node->items[i + 1]);
+  --node->count;
+  node->items[node->count].clear();
+  node->items[node->count].shrink_to_fit();
+  --size;
+
+  if (node->count == 0) {
+    if (prev)
+      prev->next = node->next;
+    else
+      head = node->next;
+    if (tail == node)
+      tail = prev;
+    delete node;
+    return;
+  }
+
+  UNode *next = node->next;
+  if (next && node->count + next->count <= NODE_CAPACITY / 2) {
+    for (int i = 0; i < next->count; ++i)
+      node->items[node->count + i] = std::move(next->items[i]);
+    node->count += next->count;
+    node->next = next->next;
+    if (tail == next)
+      tail = node;
+    delete next;
+  }
+}
+
+string *UnrolledList::find(const string &key) const {
+  UNode *prev2, *prev, *node;
+  int idx;
+  if (!locate(key, prev2, prev, node, idx))
+    return nullptr;
+  return &node->items[idx];
+}
+
+// Добавление в конец
+void UnrolledList::push_back(const string &val) {
+  if (is_empty()) {
+    head = tail = new UNode();
+  }
+  insert_into(tail, tail->count, val);
+}
+
+// Добавление в начало
+void UnrolledList::push_front(const string &val) {
+  if (is_empty()) {
+    head = tail = new UNode();
+  }
+  insert_into(head, 0, val);
+}
+
+// Вставка после заданного ключа
+void UnrolledList::insert_after(const string &key, const string &val) {
+  UNode *prev2, *prev, *node;
+  int idx;
+  if (!locate(key, prev2, prev, node, idx)) {
+    cout << "Элемент '" << key << "' не найден.\n";
+    return;
+  }
+  insert_into(node, idx + 1, val);
+}
+
+// Вставка перед заданным ключом
+void UnrolledList::insert_before(const string &key, const string &val) {
+  if (is_empty())
+    return;
+  UNode *prev2, *prev, *node;
+  int idx;
+  if (!locate(key, prev2, prev, node, idx)) {
+    cout << "Элемент '" << key << "' не найден.\n";
+    return;
+  }
+  insert_into(node, idx, val);
+}
+
+// Удаление по значению
+void UnrolledList::del(const string &val) {
+  if (is_empty())
+    return;
+  UNode *prev2, *prev, *node;
+  int idx;
+  if (!locate(val, prev2, prev, node, idx)) {
+    cout << "Элемент '" << val << "' не найден.\n";
+    return;
+  }
+  erase_from(prev, node, idx);
+}
+
+// Вывод списка
+void UnrolledList::print() const {
+  for (UNode *cur = head; cur; cur = cur->next) {
+    for (int i = 0; i < cur->count; ++i)
+      cout << cur->items[i] << " ";
+  }
+  cout << endl;
+}
+
+// Получить элемент по индексу: узлы пропускаются целиком
+string *UnrolledList::get_at(int index) const {
+  if (index < 0)
+    return nullptr;
+  for (UNode *cur = head; cur; cur = cur->next) {
+    if (index < cur->count)
+      return &cur->items[index];
+    index -= cur->count;
+  }
+  return nullptr;
+}
+
+// Удаление головы
+void UnrolledList::del_head() {
+  if (is_empty())
+    return;
+  erase_from(nullptr, head, 0);
+}
+
+// Удаление хвоста
+void UnrolledList::del_tail() {
+  if (is_empty())
+    return;
+  UNode *prev = nullptr;
+  for (UNode *cur = head; cur != tail; cur = cur->next)
+    prev = cur;
+  erase_from(prev, tail, tail->count - 1);
+}
+
+// Удалить элемент после ключа
+void UnrolledList::del_after(const string &key) {
+  UNode *prev2, *prev, *node;
+  int idx;
+  if (!locate(key, prev2, prev, node, idx))
+    return;
+  if (idx + 1 < node->count)
+    erase_from(prev, node, idx + 1);
+  else if (node->next)
+    erase_from(node, node->next, 0);
+}
+
+// Удалить элемент перед ключом
+void UnrolledList::del_before(const string &key) {
+  if (is_empty())
+    return;
+  UNode *prev2, *prev, *node;
+  int idx;
+  if (!locate(key, prev2, prev, node, idx))
+    return; // не найден ключ
+  if (idx > 0)
+    erase_from(prev, node, idx - 1);
+  else if (prev)
+    erase_from(prev2, prev, prev->count - 1);
+}
+
+// Текстовая сериализация
+void UnrolledList::serialize(std::ostream &out) const {
+  out << size << "\n";
+  for (UNode *cur = head; cur; cur = cur->next) {
+    for (int i = 0; i < cur->count; ++i)
+      out << cur->items[i] << "\n";
+  }
+}
+
+// Текстовая десериализация
+void UnrolledList::deserialize(std::istream &in) {
+  int new_size = 0;
+  in >> new_size;
+  in.ignore(); // пропустить перевод строки
+
+  clear();
+
+  for (int i = 0; i < new_size; ++i) {
+    std::string val;
+    std::getline(in, val);
+    push_back(val);
+  }
+}
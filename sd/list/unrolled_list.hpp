@@ -0,0 +1,64 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+// Развёрнутый односвязный список: каждый узел хранит до NODE_CAPACITY
+// строк подряд, поэтому обход читает память блоками, а не по узлу на
+// элемент. Интерфейс повторяет List; find и get_at возвращают указатель
+// на строку внутри узла (действителен до следующей модификации).
+class UnrolledList {
+public:
+  static constexpr int NODE_CAPACITY = 16;
+
+private:
+  struct UNode {
+    std::string items[NODE_CAPACITY];
+    int count;
+    UNode *next;
+    UNode() : count(0), next(nullptr) {}
+  };
+  UNode *head;
+  UNode *tail;
+  int size;
+
+  // Позиция первого вхождения key: узел, индекс в узле и два предыдущих узла
+  bool locate(const std::string &key, UNode *&prev2, UNode *&prev, UNode *&node,
+              int &idx) const;
+  void insert_into(UNode *node, int idx, const std::string &val);
+  void erase_from(UNode *prev, UNode *node, int idx);
+  void clear();
+
+public:
+  UnrolledList();
+  ~UnrolledList();
+
+  UnrolledList(const UnrolledList &) = delete;
+  UnrolledList &operator=(const UnrolledList &) = delete;
+
+  bool is_empty() const;
+  int get_size() const;
+  int get_node_count() const;
+  std::size_t memory_usage() const; // байты узлов без содержимого длинных строк
+
+  std::string *find(const std::string &key) const;
+  void push_back(const std::string &val);
+  void insert_after(const std::string &key, const std::string &val);
+  void push_front(const std::string &val);
+  void insert_before(const std::string &key, const std::string &val);
+  void del(const std::string &val);
+  void print() const;
+  std::string *get_at(int index) const;
+  void del_tail();
+  void del_head();
+  void del_after(const std::string &key);
+  void del_before(const std::string &key);
+
+  // Текстовая сериализация и десериализация (формат List)
+  void serialize(std::ostream &out) const;
+  void deserialize(std::istream &in);
+};
+
+#endif
@@ -0,0 +1,165 @@
+#include "block_stack.hpp"
+#include <iostream>
+using namespace std;
+
+// Конструктор
+BlockStack::BlockStack() : top_block(nullptr), top_count(0), size(0) {}
+
+// Деструктор
+BlockStack::~BlockStack() {
+  Block *b = highest();
+  while (b) {
+    Block *below = b->below;
+    delete b;
+    b = below;
+  }
+}
+
+bool BlockStack::is_empty() const { return size == 0; }
+
+int BlockStack::get_size() const { return size; }
+
+// Самый верхний блок цепочки, включая запасные
+BlockStack::Block *BlockStack::highest() const {
+  Block *b = top_block;
+  while (b && b->above)
+    b = b->above;
+  return b;
+}
+
+// Перейти в блок выше вершины; новый блок выделяется, только если
+// запасного нет
+void BlockStack::step_up() {
+  Block *block = top_block ? top_block->above : nullptr;
+  if (!block) {
+    block = new Block();
+    block->below = top_block;
+    block->above = nullptr;
+    if (top_block)
+      top_block->above = block;
+  }
+  top_block = block;
+  top_count = 0;
+}
+
+// Поместить элемент на стек; присваивание переиспользует ёмкость ячейки
+void BlockStack::push(const string &val) {
+  if (!top_block || top_count == BLOCK_CAPACITY)
+    step_up();
+  top_block->items[top_count++] = val;
+  ++size;
+}
+
+// Удалить верхний элемент
+void BlockStack::pop() {
+  if (is_empty()) {
+    cout << "Стек пуст!\n";
+    return;
+  }
+  top_block->items[--top_count].clear();
+  --size;
+  if (top_count == 0 && top_block->below) {
+    top_block = top_block->below;
+    top_count = BLOCK_CAPACITY;
+  }
+}
+
+// Получить верхний элемент
+string BlockStack::top() const {
+  if (is_empty()) {
+    cout << "Стек пуст!\n";
+    return "";
+  }
+  return top_block->items[top_count - 1];
+}
+
+// Вывести стек от вершины ко дну
+void BlockStack::print() const {
+  int count = top_count;
+  for (Block *b = top_block; b; b = b->below, count = BLOCK_CAPACITY) {
+    for (int i = count - 1; i >= 0; --i)
+      cout << b->items[i] << " ";
+  }
+  cout << endl;
+}
+
+// Удалить все элементы, сохранив блоки и ёмкость строк
+void BlockStack::clear() {
+  if (!top_block)
+    return;
+  int count = top_count;
+  for (;;) {
+    for (int i = 0; i < count; ++i)
+      top_block->items[i].clear();
+    if (!top_block->below)
+      break;
+    top_block = top_block->below;
+    count = BLOCK_CAPACITY;
+  }
+  top_count = 0;
+  size = 0;
+}
+
+// Освободить запасные блоки; у пустого стека — все
+void BlockStack::shrink_to_fit() {
+  if (!top_block)
+    return;
+  Block *b = highest();
+  Block *keep = size ? top_block : nullptr;
+  while (b != keep) {
+    Block *below = b->below;
+    delete b;
+    b = below;
+  }
+  if (keep)
+    keep->above = nullptr;
+  else
+    top_block = nullptr;
+}
+
+size_t BlockStack::memory_usage() const {
+  size_t bytes = sizeof(*this);
+  for (Block *b = highest(); b; b = b->below) {
+    bytes += sizeof(Block);
+    for (int i = 0; i < BLOCK_CAPACITY; ++i) {
+      if (b->items[i].capacity() > 15) // строка вне SSO-буфера
+        bytes += b->items[i].capacity() + 1;
+    }
+  }
+  return bytes;
+}
+
+// Текстовая сериализация от вершины ко дну
+void BlockStack::serialize(std::ostream &out) const {
+  out << size << "\n";
+  int count = top_count;
+  for (Block *b = top_block; b; b = b->below, count = BLOCK_CAPACITY) {
+    for (int i = count - 1; i >= 0; --i)
+      out << b->items[i] << "\n";
+  }
+}
+
+// Текстовая десериализация: вершина ставится сразу на нужную высоту,
+// и строки читаются в ячейки сверху вниз, без промежуточного буфера
+void BlockStack::deserialize(std::istream &in) {
+  int count = 0;
+  in >> count;
+  in.ignore(); // пропустить перевод строки
+
+  clear();
+  if (count <= 0)
+    return;
+  int blocks = (count + BLOCK_CAPACITY - 1) / BLOCK_CAPACITY;
+  if (!top_block)
+    step_up();
+  for (int i = 1; i < blocks; ++i)
+    step_up();
+  top_count = count - (blocks - 1) * BLOCK_CAPACITY;
+  size = count;
+
+  int i = top_count;
+  for (Block *b = top_block; b; b = b->below, i = BLOCK_CAPACITY) {
+    while (i > 0)
+      std::getline(in, b->items[--i]);
+  }
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <string>
+
+// Стек на цепочке блоков фиксированного размера: элементы лежат подряд,
+// а рост стека не переносит уже лежащие строки, как при расширении
+// вектора. Интерфейс повторяет Stack. Опустевшие блоки остаются в цепочке
+// над вершиной, а снятые строки очищаются с сохранением ёмкости, поэтому
+// в установившемся режиме push и pop не выделяют память. Запас
+// отдаётся shrink_to_fit().
+class BlockStack {
+private:
+  static constexpr int BLOCK_CAPACITY = 64;
+
+  struct Block {
+    std::string items[BLOCK_CAPACITY];
+    Block *below; // блок ближе ко дну
+    Block *above; // запасной блок над вершиной
+  };
+
+  Block *top_block; // блок с вершиной; у пустого стека — нижний блок
+  int top_count;    // занято в верхнем блоке
+  int size;
+
+  void step_up();
+  Block *highest() const;
+
+public:
+  BlockStack();
+  ~BlockStack();
+
+  BlockStack(const BlockStack &) = delete;
+  BlockStack &operator=(const BlockStack &) = delete;
+
+  bool is_empty() const;
+  int get_size() const;
+  void push(const std::string &val);
+  void pop();
+  std::string top() const;
+  void print() const;
+
+  void clear();                     // блоки остаются в запасе
+  void shrink_to_fit();             // освободить блоки выше вершины
+  std::size_t memory_usage() const; // оценка в байтах
+
+  // Текстовая сериализация и десериализация в формате Stack
+  void serialize(std::ostream &out) const;
+  void deserialize(std::istream &in);
+};
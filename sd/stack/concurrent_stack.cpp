@@ -0,0 +1,180 @@
+#include "concurrent_stack.hpp"
+#include <new>
+#include <thread>
+using namespace std;
+
+namespace {
+
+// Случайная ячейка массива исключения: у каждого потока свой генератор
+uint32_t next_random() {
+  thread_local uint32_t state = static_cast<uint32_t>(
+      std::hash<std::thread::id>()(std::this_thread::get_id())) | 1u;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+} // namespace
+
+// Конструктор
+ConcurrentStack::ConcurrentStack() : fresh(0), size(0), eliminations(0) {
+  for (int k = 0; k < MAX_CHUNKS; ++k)
+    chunks[k].store(nullptr, memory_order_relaxed);
+  top.value.store(pack(NIL, 0), memory_order_relaxed);
+  free_top.value.store(pack(NIL, 0), memory_order_relaxed);
+  for (int s = 0; s < ELIMINATION_SLOTS; ++s)
+    slots[s].value.store(pack(NIL, 0), memory_order_relaxed);
+}
+
+// Деструктор: вызывается, когда другие потоки стек уже не трогают
+ConcurrentStack::~ConcurrentStack() {
+  for (int k = 0; k < MAX_CHUNKS; ++k)
+    delete[] chunks[k].load(memory_order_relaxed);
+}
+
+bool ConcurrentStack::is_empty() const {
+  return index_of(top.value.load(memory_order_acquire)) == NIL;
+}
+
+int ConcurrentStack::get_size() const { return size.load(memory_order_relaxed); }
+
+uint64_t ConcurrentStack::eliminated() const {
+  return eliminations.load(memory_order_relaxed);
+}
+
+// Узел по индексу: кусок k начинается с FIRST_CHUNK * (2^k - 1)
+ConcurrentStack::Node &ConcurrentStack::node(uint32_t i) const {
+  uint32_t j = i / FIRST_CHUNK + 1;
+  int k = 0;
+  while (j >>= 1)
+    ++k;
+  uint32_t offset = i - FIRST_CHUNK * ((1u << k) - 1);
+  return chunks[k].load(memory_order_acquire)[offset];
+}
+
+// Узел из стека свободных или новый; кусок под новый индекс создаёт
+// первый дошедший до него поток
+uint32_t ConcurrentStack::alloc_node() {
+  uint32_t i = pop_index(free_top.value);
+  if (i != NIL)
+    return i;
+
+  i = fresh.fetch_add(1, memory_order_relaxed);
+  uint32_t j = i / FIRST_CHUNK + 1;
+  int k = 0;
+  while (j >>= 1)
+    ++k;
+  if (k >= MAX_CHUNKS || i == NIL)
+    throw std::bad_alloc();
+  if (!chunks[k].load(memory_order_acquire)) {
+    Node *chunk = new Node[FIRST_CHUNK << k];
+    Node *expected = nullptr;
+    if (!chunks[k].compare_exchange_strong(expected, chunk,
+                                           memory_order_acq_rel))
+      delete[] chunk;
+  }
+  return i;
+}
+
+bool ConcurrentStack::try_push(atomic<uint64_t> &head, uint32_t i) {
+  uint64_t old = head.load(memory_order_relaxed);
+  node(i).next.store(index_of(old), memory_order_relaxed);
+  return head.compare_exchange_weak(old, pack(i, tag_of(old) + 1),
+                                    memory_order_release,
+                                    memory_order_relaxed);
+}
+
+bool ConcurrentStack::try_pop(atomic<uint64_t> &head, uint32_t &i,
+                              bool &empty) {
+  uint64_t old = head.load(memory_order_acquire);
+  i = index_of(old);
+  empty = i == NIL;
+  if (empty)
+    return false;
+  // Узел мог быть уже снят другим потоком: next тогда устарел, но метка
+  // вершины сменилась, и CAS не пройдёт
+  uint32_t next = node(i).next.load(memory_order_relaxed);
+  return head.compare_exchange_weak(old, pack(next, tag_of(old) + 1),
+                                    memory_order_acquire,
+                                    memory_order_relaxed);
+}
+
+void ConcurrentStack::push_index(atomic<uint64_t> &head, uint32_t i) {
+  while (!try_push(head, i)) {
+  }
+}
+
+uint32_t ConcurrentStack::pop_index(atomic<uint64_t> &head) {
+  uint32_t i;
+  bool empty;
+  while (!try_pop(head, i, empty)) {
+    if (empty)
+      return NIL;
+  }
+  return i;
+}
+
+// Выложить узел в ячейку и подождать встречный pop; true, если узел
+// забран, false — push нужно повторить на вершине
+bool ConcurrentStack::offer(uint32_t i) {
+  atomic<uint64_t> &slot = slots[next_random() % ELIMINATION_SLOTS].value;
+  uint64_t v = slot.load(memory_order_relaxed);
+  if (index_of(v) != NIL)
+    return false;
+  uint64_t mine = pack(i, tag_of(v) + 1);
+  if (!slot.compare_exchange_strong(v, mine, memory_order_release,
+                                    memory_order_relaxed))
+    return false;
+  for (int spin = 0; spin < ELIMINATION_SPINS; ++spin) {
+    if (slot.load(memory_order_relaxed) != mine)
+      return true;
+  }
+  // Забрать предложение обратно; не вышло — его успели взять
+  return !slot.compare_exchange_strong(mine, pack(NIL, tag_of(mine) + 1),
+                                       memory_order_relaxed);
+}
+
+// Забрать узел, выложенный встречным push
+bool ConcurrentStack::take(uint32_t &i) {
+  atomic<uint64_t> &slot = slots[next_random() % ELIMINATION_SLOTS].value;
+  uint64_t v = slot.load(memory_order_relaxed);
+  i = index_of(v);
+  if (i == NIL)
+    return false;
+  if (!slot.compare_exchange_strong(v, pack(NIL, tag_of(v) + 1),
+                                    memory_order_acquire,
+                                    memory_order_relaxed))
+    return false;
+  eliminations.fetch_add(1, memory_order_relaxed);
+  return true;
+}
+
+// Положить элемент: CAS на вершине, при конфликте — массив исключения
+void ConcurrentStack::push(const string &val) {
+  uint32_t i = alloc_node();
+  node(i).data = val;
+  size.fetch_add(1, memory_order_relaxed);
+  while (!try_push(top.value, i)) {
+    if (offer(i))
+      return;
+  }
+}
+
+// Снять элемент, переместив строку без копирования
+bool ConcurrentStack::pop(string &out) {
+  uint32_t i;
+  bool empty;
+  while (!try_pop(top.value, i, empty)) {
+    if (empty)
+      return false;
+    if (take(i))
+      break;
+  }
+  size.fetch_sub(1, memory_order_relaxed);
+  Node &n = node(i);
+  out = std::move(n.data);
+  n.data.clear();
+  push_index(free_top.value, i);
+  return true;
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Неблокирующий стек Трайбера. Узлы берутся из собственного пула и
+// адресуются 32-битными индексами; вершина хранит индекс вместе с
+// 32-битной меткой в одном 64-битном слове, и метка растёт при каждой
+// удачной CAS — так исключается ABA без двойной CAS. Память узлов не
+// возвращается системе до разрушения стека, поэтому чтение next у уже
+// снятого узла безопасно, а неудачная CAS просто повторяется. Снятые узлы
+// уходят в такой же стек свободных узлов.
+//
+// При конфликте на вершине поток переходит в массив исключения: push
+// выкладывает узел в случайную ячейку и ждёт, pop забирает его оттуда, и
+// пара взаимно гасится, не трогая вершину.
+class ConcurrentStack {
+private:
+  static constexpr std::uint32_t NIL = UINT32_MAX;
+  static constexpr std::uint32_t FIRST_CHUNK = 64; // кусок k — FIRST_CHUNK << k узлов
+  static constexpr int MAX_CHUNKS = 26;
+  static constexpr int ELIMINATION_SLOTS = 8;
+  static constexpr int ELIMINATION_SPINS = 256;
+
+  struct Node {
+    std::string data;
+    std::atomic<std::uint32_t> next;
+    Node() : next(NIL) {}
+  };
+
+  // Метка и индекс в одном слове; отдельная строка кэша на каждое
+  struct alignas(64) TaggedHead {
+    std::atomic<std::uint64_t> value;
+  };
+
+  std::atomic<Node *> chunks[MAX_CHUNKS];
+  std::atomic<std::uint32_t> fresh; // первый ни разу не выданный индекс
+  TaggedHead top;
+  TaggedHead free_top;
+  TaggedHead slots[ELIMINATION_SLOTS];
+  std::atomic<int> size;
+  std::atomic<std::uint64_t> eliminations;
+
+  static std::uint64_t pack(std::uint32_t index, std::uint32_t tag) {
+    return static_cast<std::uint64_t>(tag) << 32 | index;
+  }
+  static std::uint32_t index_of(std::uint64_t v) {
+    return static_cast<std::uint32_t>(v);
+  }
+  static std::uint32_t tag_of(std::uint64_t v) {
+    return static_cast<std::uint32_t>(v >> 32);
+  }
+
+  Node &node(std::uint32_t i) const;
+  std::uint32_t alloc_node();
+  // Одна попытка CAS; false при конфликте
+  bool try_push(std::atomic<std::uint64_t> &head, std::uint32_t i);
+  bool try_pop(std::atomic<std::uint64_t> &head, std::uint32_t &i, bool &empty);
+  // Гарантированно положить или снять (для стека свободных узлов)
+  void push_index(std::atomic<std::uint64_t> &head, std::uint32_t i);
+  std::uint32_t pop_index(std::atomic<std::uint64_t> &head);
+  bool offer(std::uint32_t i);   // push через массив исключения
+  bool take(std::uint32_t &i);   // pop через массив исключения
+
+public:
+  ConcurrentStack();
+  ~ConcurrentStack();
+
+  ConcurrentStack(const ConcurrentStack &) = delete;
+  ConcurrentStack &operator=(const ConcurrentStack &) = delete;
+
+  bool is_empty() const;
+  int get_size() const; // при параллельных правках — приблизительно
+
+  void push(const std::string &val);
+  bool pop(std::string &out); // false, если стек пуст
+
+  // Сколько пар push/pop погасилось в массиве исключения
+  std::uint64_t eliminated() const;
+};
@@ -22,6 +22,13 @@ void Stack::push(const string &val) {
   top_node = node;
 }
 
+// Поместить элемент на стек, переместив строку
+void Stack::push(string &&val) {
+  SNode *node = new SNode(std::move(val));
+  node->next = top_node;
+  top_node = node;
+}
+
 // Удалить верхний элемент
 void Stack::pop() {
   if (is_empty()) {
@@ -42,6 +49,38 @@ string Stack::top() const {
   return top_node->data;
 }
 
+// Снять верхний элемент с перемещением строки
+string Stack::pop_value() {
+  string val;
+  if (!try_pop(val))
+    cout << "Стек пуст!\n";
+  return val;
+}
+
+// Снять верхний элемент в out; false, если стек пуст
+bool Stack::try_pop(string &out) {
+  if (is_empty())
+    return false;
+  SNode *tmp = top_node;
+  top_node = top_node->next;
+  out = std::move(tmp->data);
+  delete tmp;
+  return true;
+}
+
+// Снять до n элементов в out
+size_t Stack::pop_n(size_t n, std::vector<std::string> &out) {
+  size_t count = 0;
+  while (count < n && top_node) {
+    SNode *tmp = top_node;
+    top_node = top_node->next;
+    out.push_back(std::move(tmp->data));
+    delete tmp;
+    ++count;
+  }
+  return count;
+}
+
 // Вывести стек
 void Stack::print() const {
   SNode *cur = top_node;
@@ -83,16 +122,13 @@ void Stack::deserialize(std::istream &in) {
     pop();
   }
 
-  // Загружаем элементы в обратном порядке (чтобы восстановить структуру)
-  std::vector<std::string> temp;
+  // Строки записаны от вершины вниз: каждая следующая цепляется под
+  // предыдущей, без промежуточного буфера
+  SNode **bottom = &top_node;
   for (int i = 0; i < size; ++i) {
-    std::string val;
-    std::getline(in, val);
-    temp.push_back(val);
-  }
-
-  // Добавляем в обратном порядке для восстановления стека
-  for (int i = size - 1; i >= 0; --i) {
-    push(temp[i]);
+    SNode *node = new SNode(std::string());
+    std::getline(in, node->data);
+    *bottom = node;
+    bottom = &node->next;
   }
 }
\ No newline at end of file
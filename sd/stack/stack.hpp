@@ -1,6 +1,7 @@
 #pragma once
 #include <istream>
 #include <ostream>
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -10,6 +11,7 @@ private:
     std::string data;
     SNode *next;
     SNode(const std::string &val) : data(val), next(nullptr) {}
+    SNode(std::string &&val) : data(std::move(val)), next(nullptr) {}
   };
 
   SNode *top_node; // указатель на вершину стека
@@ -20,10 +22,27 @@ public:
 
   bool is_empty() const;             // проверить пустоту
   void push(const std::string &val); // положить элемент на стек
+  void push(std::string &&val);      // положить, переместив строку
   void pop();                        // удалить верхний элемент
   std::string top() const;           // получить верхний элемент
   void print() const;                // вывести стек
 
+  // Снять верхний элемент, переместив строку без копирования.
+  // pop_value у пустого стека печатает сообщение и возвращает "",
+  // try_pop молча возвращает false.
+  std::string pop_value();
+  bool try_pop(std::string &out);
+
+  // Положить элементы [first, last) по порядку: последний окажется на
+  // вершине. С std::make_move_iterator строки перемещаются.
+  template <typename It> void push_range(It first, It last) {
+    for (; first != last; ++first)
+      push(*first);
+  }
+  // Снять до n элементов в конец out (от вершины вниз); возвращает,
+  // сколько снято
+  std::size_t pop_n(std::size_t n, std::vector<std::string> &out);
+
   // Текстовая сериализация и десериализация
   void serialize(std::ostream &out) const;
   void deserialize(std::istream &in);
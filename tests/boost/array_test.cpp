@@ -2,7 +2,10 @@
 #include <sstream>
 #include <iostream>
 #include <chrono>
+#include <vector>
 #include "../../sd/array/array.hpp"
+#include "../../sd/array/pool_array.hpp"
+#include "../../sd/array/seg_array.hpp"
 
 BOOST_AUTO_TEST_SUITE(ArraySuite)
 
@@ -369,6 +372,160 @@ BOOST_AUTO_TEST_CASE(MultipleInsertDeleteTest)
     std::cout.rdbuf(old);
 }
 
+BOOST_AUTO_TEST_CASE(PushBackMoveAndEmplace)
+{
+    Mass arr;
+    std::string big(500, 'q');
+    arr.push_back(std::move(big));
+    arr.emplace_back(2, 'z');
+    for (int i = 0; i < 20; ++i) {
+        arr.push_back("grow_" + std::to_string(i));
+    }
+    BOOST_TEST(arr.get_size() == 22);
+    BOOST_TEST(arr.get_at(0) == std::string(500, 'q'));
+    BOOST_TEST(arr.get_at(1) == "zz");
+    BOOST_TEST(arr.get_at(21) == "grow_19");
+}
+
+BOOST_AUTO_TEST_CASE(RangeOperations)
+{
+    Mass arr;
+    for (int i = 0; i < 6; ++i) {
+        arr.push_back(std::to_string(i));
+    }
+    std::vector<std::string> batch = {"x", "y"};
+    arr.insert_range(3, batch.begin(), batch.end());
+    BOOST_TEST(arr.get_size() == 8);
+    BOOST_TEST(arr.get_at(3) == "x");
+    BOOST_TEST(arr.get_at(5) == "3");
+
+    arr.erase_range(0, 3);
+    BOOST_TEST(arr.get_size() == 5);
+    BOOST_TEST(arr.get_at(0) == "x");
+
+    Mass other;
+    other.push_back("tail");
+    arr.append(other);
+    BOOST_TEST(arr.get_size() == 6);
+    BOOST_TEST(arr.get_at(5) == "tail");
+}
+
+BOOST_AUTO_TEST_CASE(PoolMassBasic)
+{
+    PoolMass arr;
+    arr.push_back("a");
+    arr.push_back("bb");
+    arr.insert_at(1, "x");
+    BOOST_TEST(arr.get_size() == 3);
+    BOOST_TEST(arr.get_at(1) == "x");
+    arr.replace_at(2, "longer");
+    arr.del_at(0);
+    arr.compact();
+    BOOST_TEST(arr.get_at(0) == "x");
+    BOOST_TEST(arr.get_at(1) == "longer");
+    BOOST_TEST(arr.bytes_used() == 7u);
+}
+
+BOOST_AUTO_TEST_CASE(IteratorsAndViews)
+{
+    Mass arr;
+    arr.push_back("x");
+    arr.push_back("y");
+    std::string joined;
+    for (const auto &s : arr) {
+        joined += s;
+    }
+    BOOST_TEST(joined == "xy");
+    arr[1] = "z";
+    BOOST_TEST(arr.view_at(1) == "z");
+    BOOST_TEST(arr.view_at(5).empty());
+    BOOST_TEST(arr.end() - arr.begin() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(SortAndBinarySearch)
+{
+    Mass arr;
+    for (int i = 0; i < 50000; ++i) {
+        arr.push_back(std::to_string((i * 7919) % 50000));
+    }
+    arr.parallel_sort(4);
+    bool sorted = true;
+    for (int i = 1; i < arr.get_size(); ++i) {
+        sorted = sorted && !(arr[i] < arr[i - 1]);
+    }
+    BOOST_TEST(sorted);
+    BOOST_TEST(arr.binary_search("12345"));
+    BOOST_TEST(!arr.binary_search("-1"));
+    BOOST_TEST(arr.lower_bound("0") == 0);
+}
+
+BOOST_AUTO_TEST_CASE(SegMassBasic)
+{
+    SegMass arr(4);
+    for (int i = 0; i < 20; ++i) {
+        arr.push_back(std::to_string(i));
+    }
+    arr.insert_at(10, "mid");
+    arr.del_at(0);
+    arr.replace_at(0, "first");
+    BOOST_TEST(arr.get_size() == 20);
+    BOOST_TEST(arr.get_at(0) == "first");
+    BOOST_TEST(arr.get_at(9) == "mid");
+    BOOST_TEST(arr.get_at(19) == "19");
+    BOOST_TEST(arr.get_block_count() > 1);
+}
+
+BOOST_AUTO_TEST_CASE(FindWithPrefilter)
+{
+    Mass arr;
+    for (int i = 0; i < 37; ++i) {
+        arr.push_back(i % 3 == 0 ? "match" : "item_" + std::to_string(i));
+    }
+    BOOST_TEST(arr.find("match") == 0);
+    BOOST_TEST(arr.count("match") == 13);
+    BOOST_TEST(arr.find_all("item_4").size() == 1u);
+    BOOST_TEST(arr.find_prefix("item_").size() == 24u);
+    arr.del_at(0);
+    BOOST_TEST(arr.find("match") == 2);
+    BOOST_TEST(arr.find("absent") == -1);
+}
+
+BOOST_AUTO_TEST_CASE(BasicMassOfInts)
+{
+    BasicMass<int> arr;
+    for (int i = 0; i < 10; ++i) {
+        arr.push_back(i * i);
+    }
+    arr.insert_at(5, -5);
+    arr.del_at(0);
+    BOOST_TEST(arr.get_size() == 10);
+    BOOST_TEST(arr.get_at(4) == -5);
+
+    std::stringstream ss;
+    arr.serialize(ss);
+    BasicMass<int> restored;
+    restored.deserialize(ss);
+    BOOST_TEST(restored.get_size() == 10);
+    BOOST_TEST(restored.get_at(9) == 81);
+}
+
+BOOST_AUTO_TEST_CASE(GrowthAndShrinkPolicy)
+{
+    Mass arr;
+    arr.set_growth_factor(1.5);
+    arr.set_shrink_threshold(0.25);
+    for (int i = 0; i < 100; ++i) {
+        arr.push_back(std::to_string(i));
+    }
+    int grown = arr.get_capacity();
+    BOOST_TEST(grown >= 100);
+    arr.erase_range(0, 90);
+    BOOST_TEST(arr.get_capacity() < grown);
+    BOOST_TEST(arr.get_at(0) == "90");
+    arr.shrink_to_fit();
+    BOOST_TEST(arr.get_capacity() == 10);
+}
+
 // ===== БЕНЧМАРКИ =====
 BOOST_AUTO_TEST_CASE(BENCHMARK_PushBack, * boost::unit_test::label("benchmark"))
 {
@@ -466,4 +623,46 @@ BOOST_AUTO_TEST_CASE(BENCHMARK_MixedOperations, * boost::unit_test::label("bench
     BOOST_TEST_MESSAGE("mixed operations (insert+delete+replace x500): " << duration.count() << " ms");
 }
 
+BOOST_AUTO_TEST_CASE(BENCHMARK_InsertRange, * boost::unit_test::label("benchmark"))
+{
+    std::vector<std::string> batch;
+    for (int i = 0; i < 1000; ++i) {
+        batch.push_back("batch_" + std::to_string(i));
+    }
+    Mass arr;
+    for (int i = 0; i < 10000; ++i) {
+        arr.push_back("elem_" + std::to_string(i));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    arr.insert_range(0, batch.begin(), batch.end());
+    arr.erase_range(0, 1000);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    BOOST_TEST_MESSAGE("insert_range(1000) + erase_range(1000): " << duration.count() << " us");
+}
+
+BOOST_AUTO_TEST_CASE(BENCHMARK_IteratorScan, * boost::unit_test::label("benchmark"))
+{
+    Mass arr;
+    for (int i = 0; i < 100000; ++i) {
+        arr.push_back("elem_" + std::to_string(i));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    size_t total = 0;
+    for (const auto &s : arr) {
+        total += s.size();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    BOOST_TEST_MESSAGE("iterator scan x100000: " << duration.count() << " us (" << total << " bytes)");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
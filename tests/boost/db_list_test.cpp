@@ -1,5 +1,10 @@
 #include <boost/test/unit_test.hpp>
 #include "../../sd/db_list/db_list.hpp"
+#include "../../sd/db_list/lru_cache.hpp"
+#include "../../sd/db_list/compact_db_list.hpp"
+#include "../../sd/db_list/concurrent_db_list.hpp"
+#include <thread>
+#include <vector>
 #include <sstream>
 #include <iostream>
 #include <chrono>
@@ -136,6 +141,172 @@ BOOST_AUTO_TEST_CASE(PrintForwardBackward)
 }
 
 // ===== БЕНЧМАРКИ =====
+BOOST_AUTO_TEST_CASE(IteratorTest)
+{
+    DoublyList l;
+    l.push_back("1");
+    l.push_back("2");
+    l.push_back("3");
+    std::string fwd, bwd;
+    for (const std::string& s : l) {
+        fwd += s;
+    }
+    for (auto it = l.end(); it != l.begin();) {
+        bwd += *--it;
+    }
+    BOOST_TEST(fwd == "123");
+    BOOST_TEST(bwd == "321");
+}
+
+BOOST_AUTO_TEST_CASE(CursorTest)
+{
+    DoublyList l;
+    auto first = l.push_back("1");
+    auto last = l.push_back("3");
+    l.insert_after(first, "2");
+    l.insert_before(first, "0");
+    auto it = l.erase(last);
+    BOOST_TEST((it == l.end()));
+    std::stringstream ss;
+    l.serialize(ss);
+    BOOST_TEST(ss.str() == "3\n0\n1\n2\n");
+    BOOST_TEST(*++first == "2");
+}
+
+BOOST_AUTO_TEST_CASE(CompactTest)
+{
+    DoublyList l;
+    for (int i = 0; i < 20; ++i) {
+        l.push_back(std::to_string(i));
+    }
+    l.del("5");
+    l.compact();
+    BOOST_TEST(l.get_size() == 19);
+    BOOST_TEST(l.get_at(5)->prev->data == "4");
+    BOOST_TEST(l.get_at(5)->data == "6");
+    l.del_tail();
+    BOOST_TEST(l.get_at(17)->next == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(PositionIndexTest)
+{
+    DoublyList l;
+    l.enable_position_index();
+    for (int i = 0; i < 100; ++i) {
+        l.push_back(std::to_string(i));
+    }
+    l.insert_at(50, "x");
+    BOOST_TEST(l.get_at(50)->data == "x");
+    BOOST_TEST(l.get_at(51)->prev->data == "x");
+    l.del_at(0);
+    l.insert_after("99", "y");
+    l.del("10");
+    BOOST_TEST(l.get_size() == 100);
+    BOOST_TEST(l.get_at(8)->data == "9");
+    BOOST_TEST(l.get_at(9)->data == "11");
+    BOOST_TEST(l.get_at(99)->data == "y");
+    l.sort();
+    BOOST_TEST(l.get_at(99)->data == "y");
+    BOOST_TEST(l.get_at(98)->data == "x");
+}
+
+BOOST_AUTO_TEST_CASE(SortTest)
+{
+    DoublyList l;
+    for (int i = 9; i >= 0; --i) {
+        l.push_back(std::to_string(i % 5));
+    }
+    l.sort();
+    std::stringstream ss;
+    l.serialize(ss);
+    BOOST_TEST(ss.str() == "10\n0\n0\n1\n1\n2\n2\n3\n3\n4\n4\n");
+    BOOST_TEST(l.get_at(9)->prev == l.get_at(8));
+    l.del_tail();
+    BOOST_TEST(l.get_at(8)->data == "4");
+    BOOST_TEST(l.get_at(8)->next == nullptr);
+
+    l.parallel_sort(2);
+    BOOST_TEST(l.get_size() == 9);
+    BOOST_TEST(l.get_at(0)->prev == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(SpliceTest)
+{
+    DoublyList a, b;
+    a.push_back("a");
+    a.push_back("d");
+    b.push_back("b");
+    b.push_back("c");
+    a.splice(a.find("d"), b);
+    BOOST_TEST(a.get_size() == 4);
+    BOOST_TEST(a.get_at(3)->prev->data == "c");
+    a.split_at(1, b);
+    BOOST_TEST(a.get_size() == 1);
+    BOOST_TEST(b.get_at(0)->prev == nullptr);
+    BOOST_TEST(b.get_at(2)->data == "d");
+    a.concat(b);
+    BOOST_TEST(a.get_at(3)->next == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(CompactListTest)
+{
+    CompactDoublyList l;
+    l.push_back("b");
+    l.push_front("a");
+    l.push_back("d");
+    l.insert_before("d", "c");
+    l.del_after("d");
+    l.del_head();
+    l.push_front("z");
+    std::stringstream ss;
+    l.serialize(ss);
+    BOOST_TEST(ss.str() == "4\nz\nb\nc\nd\n");
+    BOOST_TEST(*l.get_at(3) == "d");
+    BOOST_TEST(l.find("a") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentListTest)
+{
+    ConcurrentDoublyList l;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&l, t] {
+            for (int i = 0; i < 500; ++i) {
+                l.push_back(std::to_string(t));
+                l.insert_after(std::to_string(t), "x");
+                l.del_after(std::to_string(t));
+            }
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+    BOOST_TEST(l.get_size() == 2000);
+    std::string v;
+    int popped = 0;
+    while (l.pop_front(v)) {
+        ++popped;
+    }
+    BOOST_TEST(popped == 2000);
+    BOOST_TEST(!l.del("0"));
+}
+
+BOOST_AUTO_TEST_CASE(LRUCacheTest)
+{
+    LRUCache<std::string, std::string> cache(2);
+    cache.put("a", "1");
+    cache.put("b", "2");
+    BOOST_TEST(*cache.get("a") == "1");
+    cache.put("c", "3");
+    BOOST_TEST(cache.get("b") == nullptr);
+    BOOST_TEST(cache.contains("a"));
+    BOOST_TEST(cache.hits() == 1u);
+    BOOST_TEST(cache.misses() == 1u);
+    BOOST_TEST(cache.evictions() == 1u);
+    BOOST_TEST(cache.erase("a"));
+    BOOST_TEST(cache.get_size() == 1u);
+}
+
 BOOST_AUTO_TEST_CASE(BENCHMARK_PushBack, * boost::unit_test::label("benchmark"))
 {
     auto start = std::chrono::high_resolution_clock::now();
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <chrono>
 #include "../../sd/list/list.hpp"
+#include "../../sd/list/unrolled_list.hpp"
 
 BOOST_AUTO_TEST_SUITE(ListSuite)
 
@@ -463,6 +464,149 @@ BOOST_AUTO_TEST_CASE(EmptyListAfterMultipleDeletions)
 }
 
 // ===== БЕНЧМАРКИ =====
+BOOST_AUTO_TEST_CASE(RangeForTest)
+{
+    List l;
+    l.push_back("x");
+    l.push_back("y");
+    l.push_back("z");
+    std::string all;
+    for (const std::string& s : l) {
+        all += s;
+    }
+    BOOST_TEST(all == "xyz");
+    BOOST_TEST(*++l.begin() == "y");
+}
+
+BOOST_AUTO_TEST_CASE(SelfOrganizingFindTest)
+{
+    List l;
+    l.push_back("a");
+    l.push_back("b");
+    l.push_back("c");
+    l.set_find_mode(List::FindMode::Transpose);
+    l.find("c");
+    BOOST_TEST(l.get_at(1)->data == "c");
+    l.set_find_mode(List::FindMode::MoveToFront);
+    l.find("b");
+    BOOST_TEST(l.get_at(0)->data == "b");
+    BOOST_TEST(l.get_at(1)->data == "a");
+    BOOST_TEST(l.get_at(2)->data == "c");
+}
+
+BOOST_AUTO_TEST_CASE(CompactTest)
+{
+    List l;
+    for (int i = 0; i < 50; ++i) {
+        l.push_back(std::to_string(i));
+    }
+    for (int i = 0; i < 50; i += 2) {
+        l.del(std::to_string(i));
+    }
+    BOOST_TEST(l.compact() > 0u);
+    BOOST_TEST(l.get_size() == 25);
+    BOOST_TEST(l.get_at(24)->data == "49");
+    l.del("49");
+    l.push_back("end");
+    BOOST_TEST(l.get_at(24)->data == "end");
+}
+
+BOOST_AUTO_TEST_CASE(SortTest)
+{
+    List l;
+    l.push_back("c");
+    l.push_back("a");
+    l.push_back("b");
+    l.sort();
+    std::stringstream ss;
+    l.serialize(ss);
+    BOOST_TEST(ss.str() == "3\na\nb\nc\n");
+    l.push_back("d");
+    BOOST_TEST(l.get_at(3)->data == "d");
+}
+
+BOOST_AUTO_TEST_CASE(SpliceAndSplit)
+{
+    List a, b;
+    a.push_back("1");
+    a.push_back("4");
+    b.push_back("2");
+    b.push_back("3");
+    a.splice(a.find("1"), b);
+    BOOST_TEST(b.is_empty());
+    List rest;
+    a.split_at(2, rest);
+    BOOST_TEST(a.get_size() == 2);
+    BOOST_TEST(rest.get_at(0)->data == "3");
+    a.concat(rest);
+    std::stringstream ss;
+    a.serialize(ss);
+    BOOST_TEST(ss.str() == "4\n1\n2\n3\n4\n");
+}
+
+BOOST_AUTO_TEST_CASE(IndexedKeyOperations)
+{
+    List l;
+    l.enable_index();
+    for (int i = 0; i < 10; ++i) {
+        l.push_back(std::to_string(i));
+    }
+    l.insert_before("5", "a");
+    l.insert_after("5", "b");
+    l.del_before("3");
+    l.del_after("7");
+    l.del("0");
+    l.push_front("5");
+
+    std::stringstream ss;
+    l.serialize(ss);
+    BOOST_TEST(ss.str() == "10\n5\n1\n3\n4\na\n5\nb\n6\n7\n9\n");
+    BOOST_TEST(l.find("5") == l.get_at(0));
+    l.del_head();
+    BOOST_TEST(l.find("5") == l.get_at(4));
+    BOOST_TEST(l.index_memory_usage() > 0u);
+}
+
+BOOST_AUTO_TEST_CASE(UnrolledListBasicOperations)
+{
+    UnrolledList l;
+    for (int i = 0; i < 40; ++i) {
+        l.push_back(std::to_string(i));
+    }
+    l.push_front("f");
+    l.insert_after("16", "x");
+    l.insert_before("16", "y");
+    l.del("0");
+    l.del_after("31");
+    l.del_before("17");
+    l.del_tail();
+
+    BOOST_TEST(l.get_size() == 39);
+    BOOST_TEST(*l.get_at(0) == "f");
+    BOOST_TEST(*l.get_at(1) == "1");
+    BOOST_TEST(*l.get_at(16) == "y");
+    BOOST_TEST(*l.get_at(17) == "16");
+    BOOST_TEST(*l.get_at(18) == "17");
+    BOOST_TEST(l.find("32") == nullptr);
+    BOOST_TEST(l.find("39") == nullptr);
+    BOOST_TEST(*l.get_at(38) == "38");
+}
+
+BOOST_AUTO_TEST_CASE(UnrolledListSerialization)
+{
+    UnrolledList l;
+    for (int i = 0; i < 20; ++i) {
+        l.push_back("s" + std::to_string(i));
+    }
+    std::stringstream ss;
+    l.serialize(ss);
+
+    List copy;
+    copy.deserialize(ss);
+    BOOST_TEST(copy.get_size() == 20);
+    BOOST_TEST(copy.get_at(19)->data == "s19");
+}
+
 BOOST_AUTO_TEST_CASE(BENCHMARK_PushBack, * boost::unit_test::label("benchmark"))
 {
     auto start = std::chrono::high_resolution_clock::now();
@@ -1,7 +1,10 @@
 #include <boost/test/unit_test.hpp>
 #include <sstream>
 #include <iostream>
+#include <fstream>
+#include <cstdio>
 #include "../../sd/array/array.hpp"
+#include "../../sd/array/mass_view.hpp"
 #include "../../sd/list/list.hpp"
 #include "../../sd/stack/stack.hpp"
 #include "../../sd/queue/queue.hpp"
@@ -271,4 +274,25 @@ BOOST_AUTO_TEST_CASE(DoublyListTextSerializationEmpty)
     BOOST_TEST(restored.is_empty() == true);
 }
 
+// MassView поверх индексированного снимка
+BOOST_AUTO_TEST_CASE(MassViewIndexedSnapshot)
+{
+    const std::string path = "mass_view_boost.bin";
+    Mass original;
+    original.push_back("alpha");
+    original.push_back("beta");
+    {
+        std::ofstream out(path, std::ios::binary);
+        original.serialize_indexed(out);
+    }
+
+    MassView view;
+    BOOST_TEST(view.open(path));
+    BOOST_TEST(view.is_indexed());
+    BOOST_TEST(view.get_size() == 2);
+    BOOST_TEST(view.get_at(1) == "beta");
+    view.close();
+    std::remove(path.c_str());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
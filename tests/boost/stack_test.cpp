@@ -3,6 +3,10 @@
 #include <iostream>
 #include <chrono>
 #include "../../sd/stack/stack.hpp"
+#include "../../sd/stack/block_stack.hpp"
+#include "../../sd/stack/concurrent_stack.hpp"
+#include <thread>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(StackSuite)
 
@@ -480,6 +484,76 @@ BOOST_AUTO_TEST_CASE(SingleElementStack)
     BOOST_TEST(s.is_empty() == true);
 }
 
+BOOST_AUTO_TEST_CASE(MoveOutAndBatchOps)
+{
+    Stack s;
+    std::vector<std::string> items = {"a", "b", "c"};
+    s.push_range(items.begin(), items.end());
+    BOOST_TEST(s.pop_value() == "c");
+
+    std::vector<std::string> out;
+    BOOST_TEST(s.pop_n(5, out) == 2u);
+    BOOST_TEST(out.size() == 2u);
+    BOOST_TEST(out[0] == "b");
+    BOOST_TEST(out[1] == "a");
+
+    std::string val;
+    BOOST_TEST(s.try_pop(val) == false);
+    s.push("z");
+    BOOST_TEST(s.try_pop(val) == true);
+    BOOST_TEST(val == "z");
+}
+
+BOOST_AUTO_TEST_CASE(BlockStackLIFO)
+{
+    BlockStack s;
+    for (int i = 0; i < 150; ++i) {
+        s.push(std::to_string(i));
+    }
+    BOOST_TEST(s.get_size() == 150);
+    for (int i = 149; i >= 60; --i) {
+        BOOST_TEST(s.top() == std::to_string(i));
+        s.pop();
+    }
+    s.push("x");
+    BOOST_TEST(s.top() == "x");
+
+    std::stringstream ss;
+    s.serialize(ss);
+    BlockStack copy;
+    copy.deserialize(ss);
+    BOOST_TEST(copy.get_size() == 61);
+    BOOST_TEST(copy.top() == "x");
+    copy.pop();
+    BOOST_TEST(copy.top() == "59");
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentStackPushPop)
+{
+    ConcurrentStack s;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&s, t] {
+            for (int i = 0; i < 5000; ++i) {
+                s.push(std::to_string(t));
+            }
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+    BOOST_TEST(s.get_size() == 20000);
+    int counts[4] = {0, 0, 0, 0};
+    std::string out;
+    while (s.pop(out)) {
+        ++counts[std::stoi(out)];
+    }
+    for (int c : counts) {
+        BOOST_TEST(c == 5000);
+    }
+    BOOST_TEST(s.is_empty());
+}
+
 // ===== БЕНЧМАРКИ =====
 BOOST_AUTO_TEST_CASE(BENCHMARK_Push, * boost::unit_test::label("benchmark"))
 {
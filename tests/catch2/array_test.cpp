@@ -1,8 +1,13 @@
 #include <catch2/catch_all.hpp>
 #include "../../sd/array/array.hpp"
+#include "../../sd/array/pool_array.hpp"
+#include "../../sd/array/seg_array.hpp"
 #include <iostream>
 #include <sstream>
 #include <chrono>
+#include <vector>
+#include <algorithm>
+#include <memory_resource>
 
 
 TEST_CASE("Mass — 100 coverage", "[array]") {
@@ -261,6 +266,128 @@ TEST_CASE("Mass — read() with empty input", "[array][read]") {
     REQUIRE(m.is_empty());
 }
 
+TEST_CASE("Mass — перемещение и emplace_back", "[array]") {
+    Mass m;
+    std::string big(300, 'w');
+    m.push_back(std::move(big));
+    REQUIRE(m.emplace_back("e") == "e");
+    for (int i = 0; i < 10; ++i) m.push_back("v" + std::to_string(i));
+    REQUIRE(m.get_size() == 12);
+    REQUIRE(m.get_at(0) == std::string(300, 'w'));
+    REQUIRE(m.get_at(11) == "v9");
+    m.insert_at(0, "head");
+    m.del_at(1);
+    REQUIRE(m.get_at(0) == "head");
+    REQUIRE(m.get_at(1) == "e");
+}
+
+TEST_CASE("Mass — пакетные вставка и удаление", "[array]") {
+    Mass m;
+    for (int i = 0; i < 4; ++i) m.push_back(std::to_string(i));
+    std::vector<std::string> batch = {"a", "b", "c", "d", "e"};
+    m.insert_range(1, batch.begin(), batch.end());
+    REQUIRE(m.get_size() == 9);
+    REQUIRE(m.get_at(1) == "a");
+    REQUIRE(m.get_at(6) == "1");
+    m.erase_range(1, 6);
+    REQUIRE(m.get_size() == 4);
+    REQUIRE(m.get_at(1) == "1");
+    m.append(m);
+    REQUIRE(m.get_size() == 8);
+    REQUIRE(m.get_at(7) == "3");
+}
+
+TEST_CASE("PoolMass — арена строк", "[array]") {
+    PoolMass p;
+    p.reserve(4, 64);
+    p.push_back("first");
+    p.push_back("second");
+    REQUIRE(p.get_at(0) == "first");
+    REQUIRE(p.get_at(5).empty());
+    p.replace_at(0, "1st");
+    p.del_at(1);
+    REQUIRE(p.get_size() == 1);
+    REQUIRE(p.bytes_used() == 3);
+    std::stringstream ss;
+    p.serialize(ss);
+    Mass m;
+    m.deserialize(ss);
+    REQUIRE(m.get_at(0) == "1st");
+}
+
+TEST_CASE("Mass — итераторы и ссылки", "[array]") {
+    Mass m;
+    for (int i = 3; i > 0; --i) m.push_back(std::to_string(i));
+    std::sort(m.begin(), m.end());
+    REQUIRE(m[0] == "1");
+    REQUIRE(m.view_at(2) == "3");
+    m[0] = "one";
+    REQUIRE(m.get_at(0) == "one");
+    int count = 0;
+    for (const auto &s : m) count += static_cast<int>(s.size());
+    REQUIRE(count == 5);
+}
+
+TEST_CASE("Mass — сортировка и поиск", "[array]") {
+    Mass m;
+    for (int i = 0; i < 30000; ++i) m.push_back(std::to_string(30000 - i));
+    m.parallel_sort(2);
+    REQUIRE(std::is_sorted(m.begin(), m.end()));
+    REQUIRE(m.binary_search("15000"));
+    REQUIRE(m.lower_bound("1") == 0);
+    m.stable_sort();
+    REQUIRE(m.get_at(0) == "1");
+}
+
+TEST_CASE("SegMass — блоки и сдвиги", "[array]") {
+    SegMass seg(2);
+    for (int i = 0; i < 9; ++i) seg.insert_at(0, std::to_string(i));
+    REQUIRE(seg.get_size() == 9);
+    REQUIRE(seg.get_at(0) == "8");
+    REQUIRE(seg.get_at(8) == "0");
+    for (int i = 0; i < 8; ++i) seg.del_at(0);
+    REQUIRE(seg.get_size() == 1);
+    REQUIRE(seg.view_at(0) == "0");
+    REQUIRE(seg.get_block_count() == 1);
+}
+
+TEST_CASE("Mass — поиск find/count/find_prefix", "[array]") {
+    Mass m;
+    for (int i = 0; i < 50; ++i) m.push_back(std::to_string(i % 5) + "_tail");
+    REQUIRE(m.find("3_tail") == 3);
+    REQUIRE(m.count("3_tail") == 10);
+    REQUIRE(m.find_all("0_tail").front() == 0);
+    REQUIRE(m.find_prefix("4_").size() == 10);
+    m.replace_at(3, "x");
+    REQUIRE(m.count("3_tail") == 9);
+    REQUIRE(m.find("nothing") == -1);
+}
+
+TEST_CASE("BasicMass<double> — тривиально копируемый тип", "[array]") {
+    BasicMass<double> m;
+    for (int i = 0; i < 20; ++i) m.push_back(i / 2.0);
+    m.erase_range(0, 10);
+    REQUIRE(m.get_size() == 10);
+    REQUIRE(m.get_at(0) == 5.0);
+    std::stringstream ss;
+    m.serialize(ss);
+    BasicMass<double> r;
+    r.deserialize(ss);
+    REQUIRE(r.get_size() == 10);
+    REQUIRE(r.get_at(9) == 9.5);
+}
+
+TEST_CASE("BasicMass на pmr-арене", "[array]") {
+    std::pmr::monotonic_buffer_resource arena;
+    BasicMass<std::string, std::pmr::polymorphic_allocator<std::string>> m(&arena);
+    for (int i = 0; i < 50; ++i) m.push_back("s" + std::to_string(i));
+    m.del_at(0);
+    REQUIRE(m.get_size() == 49);
+    REQUIRE(m.get_at(0) == "s1");
+    m.shrink_to_fit();
+    REQUIRE(m.get_capacity() == 49);
+}
+
 // ===== BENCHMARKS =====
 TEST_CASE("BENCHMARK_Array_PushBack", "[benchmark]") {
     auto start = std::chrono::high_resolution_clock::now();
@@ -1,5 +1,10 @@
 #include <catch2/catch_all.hpp>
 #include "../../sd/db_list/db_list.hpp"
+#include "../../sd/db_list/lru_cache.hpp"
+#include "../../sd/db_list/compact_db_list.hpp"
+#include "../../sd/db_list/concurrent_db_list.hpp"
+#include <thread>
+#include <vector>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -275,6 +280,141 @@ TEST_CASE("DoublyList — bidirectional operations", "[DoublyList][extra3]") {
 }
 
 // ===== BENCHMARKS =====
+TEST_CASE("DoublyList — итераторы", "[DoublyList][iterator]") {
+    DoublyList l;
+    for (const char* v : {"a", "b", "c"}) l.push_back(v);
+    for (auto& s : l) s += s;
+    auto it = l.end();
+    --it;
+    REQUIRE(*it == "cc");
+    --it;
+    REQUIRE(*it == "bb");
+    REQUIRE(++it != l.end());
+    REQUIRE(++it == l.end());
+}
+
+TEST_CASE("DoublyList — курсоры", "[DoublyList][cursor]") {
+    DoublyList l;
+    auto c = l.push_front("m");
+    for (int i = 0; i < 3; ++i) {
+        l.insert_before(c, "l" + std::to_string(i));
+        l.insert_after(c, "r" + std::to_string(i));
+    }
+    REQUIRE(l.get_size() == 7);
+    REQUIRE(l.get_at(0)->data == "l0");
+    REQUIRE(l.get_at(3)->data == "m");
+    REQUIRE(l.get_at(4)->data == "r2");
+    auto next = l.erase(c);
+    REQUIRE(*next == "r2");
+    REQUIRE(l.get_at(3)->prev->data == "l2");
+}
+
+TEST_CASE("DoublyList — compact", "[DoublyList][compact]") {
+    DoublyList l;
+    for (int i = 0; i < 10; ++i) l.push_front(std::to_string(i));
+    l.compact();
+    REQUIRE(l.get_at(0)->data == "9");
+    REQUIRE(l.get_at(9)->prev->data == "1");
+    l.push_back("x");
+    REQUIRE(l.get_at(10)->prev == l.get_at(9));
+}
+
+TEST_CASE("DoublyList — позиционный индекс", "[DoublyList][position]") {
+    DoublyList l;
+    for (int i = 0; i < 1000; ++i) l.push_back(std::to_string(i));
+    l.enable_position_index();
+    REQUIRE(l.get_size() == 1000);
+    for (int i = 0; i < 1000; i += 2) l.del_at(i / 2);
+    REQUIRE(l.get_size() == 500);
+    REQUIRE(l.get_at(0)->data == "1");
+    REQUIRE(l.get_at(499)->data == "999");
+    REQUIRE(l.get_at(500) == nullptr);
+    auto c = l.insert_at(250, "mid");
+    REQUIRE(*c == "mid");
+    REQUIRE(l.get_at(251)->data == "501");
+    l.erase(c); // индекс устаревает и перестраивается при get_at
+    REQUIRE(l.get_at(250)->data == "501");
+    l.del_before("501");
+    REQUIRE(l.get_at(249)->data == "501");
+}
+
+TEST_CASE("DoublyList — sort и parallel_sort", "[DoublyList][sort]") {
+    DoublyList l;
+    for (int i = 0; i < 20000; ++i) {
+        l.push_back(std::to_string((i * 7919) % 20000));
+    }
+    l.parallel_sort(4);
+    REQUIRE(l.get_size() == 20000);
+    for (int i = 1; i < 20000; i += 997) {
+        auto node = l.get_at(i);
+        REQUIRE(node->prev->data <= node->data);
+        REQUIRE(node->prev->next == node);
+    }
+    l.sort();
+    REQUIRE(l.get_at(0)->data == "0");
+    REQUIRE(l.get_at(19999)->data == "9999");
+    REQUIRE(l.get_at(19999)->next == nullptr);
+}
+
+TEST_CASE("DoublyList — splice и split_at", "[DoublyList][splice]") {
+    DoublyList a, b;
+    for (int i = 0; i < 6; ++i) a.push_back(std::to_string(i));
+    a.split_at(3, b);
+    REQUIRE(a.get_size() == 3);
+    REQUIRE(b.get_size() == 3);
+    a.splice(a.get_at(0), b);
+    REQUIRE(a.get_at(0)->data == "3");
+    REQUIRE(a.get_at(3)->data == "0");
+    REQUIRE(a.get_at(3)->prev->data == "5");
+    REQUIRE(a.get_at(5)->next == nullptr);
+}
+
+TEST_CASE("CompactDoublyList — базовые операции", "[CompactDoublyList]") {
+    CompactDoublyList l;
+    for (int i = 0; i < 10; ++i) l.push_back(std::to_string(i));
+    l.del("5");
+    l.insert_after("4", "x");
+    l.del_before("1");
+    l.del_tail();
+    REQUIRE(l.get_size() == 8);
+    REQUIRE(*l.get_at(0) == "1");
+    REQUIRE(*l.get_at(4) == "x");
+    REQUIRE(*l.get_at(7) == "8");
+    std::stringstream ss;
+    l.serialize(ss);
+    CompactDoublyList copy;
+    copy.deserialize(ss);
+    REQUIRE(*copy.get_at(4) == "x");
+}
+
+TEST_CASE("ConcurrentDoublyList — параллельные операции с обоих концов", "[ConcurrentDoublyList]") {
+    ConcurrentDoublyList l;
+    std::thread front([&l] { for (int i = 0; i < 1000; ++i) l.push_front("f"); });
+    std::thread back([&l] { for (int i = 0; i < 1000; ++i) l.push_back("b"); });
+    front.join();
+    back.join();
+    REQUIRE(l.get_size() == 2000);
+    std::thread pop_f([&l] { std::string v; for (int i = 0; i < 700; ++i) l.pop_front(v); });
+    std::thread pop_b([&l] { std::string v; for (int i = 0; i < 700; ++i) l.pop_back(v); });
+    pop_f.join();
+    pop_b.join();
+    REQUIRE(l.get_size() == 600);
+    std::string v;
+    REQUIRE(l.get_at(599, v));
+    REQUIRE_FALSE(l.get_at(600, v));
+}
+
+TEST_CASE("LRUCache — лимит по байтам и счётчики", "[LRUCache]") {
+    LRUCache<int, std::string> cache(100, 3 * (sizeof(int) + 4));
+    for (int i = 0; i < 5; ++i) cache.put(i, "abcd");
+    REQUIRE(cache.get_size() == 3);
+    REQUIRE(cache.evictions() == 2);
+    REQUIRE(cache.get(0) == nullptr);
+    REQUIRE(cache.get(4) != nullptr);
+    cache.put(2, "");
+    REQUIRE(cache.get_bytes() == 3 * sizeof(int) + 8);
+}
+
 TEST_CASE("BENCHMARK_DBList_PushBack", "[benchmark]") {
     auto start = std::chrono::high_resolution_clock::now();
     DoublyList l;
@@ -1,5 +1,8 @@
 #include <catch2/catch_all.hpp>
 #include "../../sd/list/list.hpp"
+#include "../../sd/list/unrolled_list.hpp"
+#include <sstream>
+#include <iterator>
 #include <string>
 #include <chrono>
 
@@ -249,6 +252,108 @@ TEST_CASE("List — complex insertions", "[List][extra2]") {
     REQUIRE(l.get_at(1)->data == "d");
 }
 
+TEST_CASE("Итерация по List", "[List]") {
+    List l;
+    for (const char* v : {"a", "b", "c"}) l.push_back(v);
+    std::string all;
+    for (const auto& s : l) all += s;
+    REQUIRE(all == "abc");
+    REQUIRE(std::distance(l.begin(), l.end()) == 3);
+}
+
+TEST_CASE("Самоорганизующийся find", "[List]") {
+    List l;
+    for (const char* v : {"1", "2", "3", "4"}) l.push_back(v);
+    l.set_find_mode(List::FindMode::MoveToFront);
+    l.find("4");
+    l.find("3");
+    REQUIRE(l.get_at(0)->data == "3");
+    REQUIRE(l.get_at(1)->data == "4");
+    REQUIRE(l.get_at(3)->data == "2");
+    l.push_back("5");
+    REQUIRE(l.get_at(4)->data == "5");
+}
+
+TEST_CASE("compact сохраняет порядок", "[List]") {
+    List l;
+    for (int i = 0; i < 30; ++i) l.push_back(std::to_string(i));
+    l.del("10");
+    l.compact();
+    REQUIRE(l.get_size() == 29);
+    REQUIRE(l.get_at(10)->data == "11");
+    REQUIRE(l.get_at(11) == l.get_at(10)->next);
+}
+
+TEST_CASE("sort перевязывает узлы", "[List]") {
+    List l;
+    for (const char* v : {"3", "1", "2", "1"}) l.push_back(v);
+    l.sort();
+    REQUIRE(l.get_at(0)->data == "1");
+    REQUIRE(l.get_at(1)->data == "1");
+    REQUIRE(l.get_at(3)->data == "3");
+    l.del_tail();
+    REQUIRE(l.get_size() == 3);
+    REQUIRE(l.get_at(2)->data == "2");
+}
+
+TEST_CASE("splice, concat и split_at", "[List]") {
+    List a, b;
+    for (const char* v : {"a", "b", "c"}) a.push_back(v);
+    for (const char* v : {"x", "y"}) b.push_back(v);
+    b.splice_range(nullptr, a, a.find("a"), a.find("c"));
+    REQUIRE(a.get_size() == 1);
+    REQUIRE(b.get_at(0)->data == "b");
+    a.concat(b);
+    REQUIRE(a.get_size() == 5);
+    a.split_at(4, b);
+    REQUIRE(b.get_at(0)->data == "y");
+    a.push_back("z");
+    REQUIRE(a.get_at(4)->data == "z");
+}
+
+TEST_CASE("Индекс по ключам согласован с обходом", "[List]") {
+    List l;
+    l.enable_index();
+    l.push_back("x");
+    l.push_back("y");
+    l.push_back("x");
+    l.insert_before("y", "z");
+    l.del("x");
+    REQUIRE(l.find("x") == l.get_at(2));
+    l.del_before("x");
+    REQUIRE(l.get_size() == 2);
+    REQUIRE(l.get_at(0)->data == "z");
+    REQUIRE(l.find("x") == l.get_at(1));
+    l.disable_index();
+    REQUIRE(l.index_memory_usage() == 0);
+}
+
+TEST_CASE("UnrolledList повторяет поведение List", "[UnrolledList]") {
+    List ref;
+    UnrolledList l;
+    for (int i = 0; i < 64; ++i) {
+        ref.push_back(std::to_string(i));
+        l.push_back(std::to_string(i));
+    }
+    for (int i = 0; i < 64; i += 2) {
+        ref.del_after(std::to_string(i));
+        l.del_after(std::to_string(i));
+    }
+    ref.insert_before("1", "z");
+    l.insert_before("1", "z");
+    ref.del_before("33");
+    l.del_before("33");
+
+    REQUIRE(l.get_size() == ref.get_size());
+    for (int i = 0; i < ref.get_size(); ++i)
+        REQUIRE(*l.get_at(i) == ref.get_at(i)->data);
+
+    std::stringstream a, b;
+    ref.serialize(a);
+    l.serialize(b);
+    REQUIRE(a.str() == b.str());
+}
+
 // ===== BENCHMARKS =====
 TEST_CASE("BENCHMARK_List_PushBack", "[benchmark]") {
     auto start = std::chrono::high_resolution_clock::now();
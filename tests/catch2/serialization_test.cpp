@@ -1,6 +1,9 @@
 #include <catch2/catch_all.hpp>
 #include <sstream>
+#include <fstream>
+#include <cstdio>
 #include "../../sd/array/array.hpp"
+#include "../../sd/array/mass_view.hpp"
 #include "../../sd/list/list.hpp"
 #include "../../sd/stack/stack.hpp"
 #include "../../sd/queue/queue.hpp"
@@ -43,6 +46,27 @@ TEST_CASE("Array Binary Serialization Empty", "[serialization]")
     REQUIRE(restored.is_empty() == true);
 }
 
+TEST_CASE("MassView over plain and indexed snapshots", "[serialization]")
+{
+    const std::string path = "mass_view_catch.bin";
+    Mass original;
+    for (int i = 0; i < 10; ++i) original.push_back("item" + std::to_string(i));
+
+    for (bool indexed : {false, true}) {
+        {
+            std::ofstream out(path, std::ios::binary);
+            if (indexed) original.serialize_indexed(out);
+            else original.serialize(out);
+        }
+        MassView view;
+        REQUIRE(view.open(path));
+        REQUIRE(view.is_indexed() == indexed);
+        REQUIRE(view.get_size() == 10);
+        REQUIRE(view.get_at(9) == "item9");
+    }
+    std::remove(path.c_str());
+}
+
 TEST_CASE("HashTable Binary Serialization", "[serialization]")
 {
     HashTable original;
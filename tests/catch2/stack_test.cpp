@@ -1,5 +1,11 @@
 #include <catch2/catch_all.hpp>
 #include "../../sd/stack/stack.hpp"
+#include "../../sd/stack/block_stack.hpp"
+#include "../../sd/stack/concurrent_stack.hpp"
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <vector>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -176,6 +182,73 @@ TEST_CASE("Stack — stress test", "[Stack][stress]") {
     REQUIRE(s.is_empty());
 }
 
+TEST_CASE("Stack — pop_value, try_pop и пакетные операции", "[Stack][batch]") {
+    Stack s;
+    std::vector<std::string> items;
+    for (int i = 0; i < 10; ++i) items.push_back(std::string(64, 'a' + i));
+    s.push_range(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+    REQUIRE(s.pop_value() == std::string(64, 'j'));
+
+    std::vector<std::string> out;
+    REQUIRE(s.pop_n(4, out) == 4);
+    REQUIRE(out.front() == std::string(64, 'i'));
+    REQUIRE(out.back() == std::string(64, 'f'));
+
+    std::stringstream ss;
+    s.serialize(ss);
+    Stack copy;
+    copy.deserialize(ss);
+    std::string val;
+    REQUIRE(copy.try_pop(val));
+    REQUIRE(val == std::string(64, 'e'));
+    while (copy.try_pop(val)) {}
+    REQUIRE(val == std::string(64, 'a'));
+    REQUIRE(copy.is_empty());
+}
+
+TEST_CASE("BlockStack — как Stack", "[BlockStack]") {
+    Stack ref;
+    BlockStack s;
+    for (int i = 0; i < 300; ++i) {
+        ref.push("e" + std::to_string(i));
+        s.push("e" + std::to_string(i));
+        if (i % 3 == 0) {
+            ref.pop();
+            s.pop();
+        }
+    }
+    std::stringstream a, b;
+    ref.serialize(a);
+    s.serialize(b);
+    REQUIRE(a.str() == b.str());
+
+    s.clear();
+    REQUIRE(s.is_empty());
+    REQUIRE(s.memory_usage() > sizeof(BlockStack));
+    s.shrink_to_fit();
+    REQUIRE(s.memory_usage() == sizeof(BlockStack));
+}
+
+TEST_CASE("ConcurrentStack — параллельные push и pop", "[ConcurrentStack]") {
+    ConcurrentStack s;
+    std::atomic<long long> popped_sum{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&] {
+            std::string out;
+            for (int i = 1; i <= 3000; ++i) {
+                s.push(std::to_string(i));
+                if (s.pop(out)) popped_sum += std::stoll(out);
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    std::string out;
+    while (s.pop(out)) popped_sum += std::stoll(out);
+    REQUIRE(popped_sum.load() == 4LL * 3000 * 3001 / 2);
+    REQUIRE(s.get_size() == 0);
+}
+
 // ===== BENCHMARKS =====
 TEST_CASE("BENCHMARK_Stack_Push", "[benchmark]") {
     auto start = std::chrono::high_resolution_clock::now();
@@ -1,9 +1,19 @@
 #include "gtest/gtest.h"
 #include "../sd/array/array.hpp"
+#include "../sd/array/pool_array.hpp"
+#include "../sd/array/seg_array.hpp"
 #include <sstream>
 #include <iostream>
 #include <cstring>
 #include <chrono>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
 
 class ArrayTest : public ::testing::Test {
 protected:
@@ -455,6 +465,816 @@ TEST(ArrayInitialStateTest, InitialState) {
     EXPECT_EQ(arr.get_size(), 0);
 }
 
+// Тесты перемещающего добавления и emplace_back
+TEST(ArrayMoveTest, PushBackRvalueMovesPayload) {
+    Mass m;
+    std::string big(1000, 'x');
+    m.push_back(std::move(big));
+    EXPECT_EQ(m.get_size(), 1);
+    EXPECT_EQ(m.get_at(0), std::string(1000, 'x'));
+}
+
+TEST(ArrayMoveTest, EmplaceBackConstructsInPlace) {
+    Mass m;
+    std::string &ref = m.emplace_back(3, 'a');
+    EXPECT_EQ(ref, "aaa");
+    m.emplace_back("literal");
+    m.emplace_back();
+    EXPECT_EQ(m.get_size(), 3);
+    EXPECT_EQ(m.get_at(1), "literal");
+    EXPECT_EQ(m.get_at(2), "");
+}
+
+TEST(ArrayMoveTest, GrowthKeepsLongStrings) {
+    Mass m;
+    for (int i = 0; i < 1000; ++i) {
+        m.push_back(std::string(50, 'a' + i % 26) + std::to_string(i));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(m.get_at(i), std::string(50, 'a' + i % 26) + std::to_string(i));
+    }
+}
+
+TEST(ArrayMoveTest, InsertAtOwnElementDuringGrowth) {
+    Mass m;
+    for (int i = 0; i < 3; ++i) m.push_back("elem_" + std::to_string(i));
+    const std::string &self = m.emplace_back("self");
+    // size == capacity: вставка ссылки на собственный элемент вызывает рост
+    m.insert_at(1, self);
+    EXPECT_EQ(m.get_size(), 5);
+    EXPECT_EQ(m.get_at(1), "self");
+    EXPECT_EQ(m.get_at(2), "elem_1");
+    EXPECT_EQ(m.get_at(4), "self");
+}
+
+TEST(ArrayMoveTest, DeserializeReplacesContents) {
+    Mass src;
+    src.push_back("alpha");
+    src.push_back(std::string(100, 'b'));
+    std::stringstream ss;
+    src.serialize(ss);
+
+    Mass dst;
+    dst.push_back("old");
+    dst.deserialize(ss);
+    EXPECT_EQ(dst.get_size(), 2);
+    EXPECT_EQ(dst.get_at(0), "alpha");
+    EXPECT_EQ(dst.get_at(1), std::string(100, 'b'));
+}
+
+// Тесты пакетных операций
+TEST(ArrayRangeTest, InsertRangeMiddleWithoutGrowth) {
+    Mass m;
+    m.reserve(16);
+    for (int i = 0; i < 5; ++i) m.push_back("e" + std::to_string(i));
+    std::vector<std::string> batch = {"a", "b", "c"};
+    m.insert_range(2, batch.begin(), batch.end());
+    ASSERT_EQ(m.get_size(), 8);
+    const char *expected[] = {"e0", "e1", "a", "b", "c", "e2", "e3", "e4"};
+    for (int i = 0; i < 8; ++i) EXPECT_EQ(m.get_at(i), expected[i]);
+}
+
+TEST(ArrayRangeTest, InsertRangeWithGrowthAndAtEnds) {
+    Mass m;
+    m.push_back("x");
+    m.push_back("y");
+    std::vector<std::string> batch;
+    for (int i = 0; i < 10; ++i) batch.push_back("b" + std::to_string(i));
+    m.insert_range(0, batch.begin(), batch.end());
+    EXPECT_EQ(m.get_size(), 12);
+    EXPECT_EQ(m.get_at(0), "b0");
+    EXPECT_EQ(m.get_at(10), "x");
+    m.insert_range(m.get_size(), batch.begin(), batch.begin() + 2);
+    EXPECT_EQ(m.get_size(), 14);
+    EXPECT_EQ(m.get_at(13), "b1");
+}
+
+TEST(ArrayRangeTest, InsertRangeInvalid) {
+    Mass m;
+    m.push_back("only");
+    std::vector<std::string> batch = {"a"};
+    m.insert_range(-1, batch.begin(), batch.end());
+    m.insert_range(2, batch.begin(), batch.end());
+    m.insert_range(0, batch.end(), batch.end());
+    EXPECT_EQ(m.get_size(), 1);
+    EXPECT_EQ(m.get_at(0), "only");
+}
+
+// Копирование бросает на заданном по счёту экземпляре
+struct ThrowingCopy {
+    static int live;
+    static int copies_left;
+    int value;
+    ThrowingCopy(int v = 0) : value(v) { ++live; }
+    ThrowingCopy(const ThrowingCopy &o) : value(o.value) {
+        if (copies_left-- == 0) throw std::runtime_error("copy");
+        ++live;
+    }
+    ThrowingCopy(ThrowingCopy &&o) noexcept : value(o.value) { ++live; }
+    ~ThrowingCopy() { --live; }
+};
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = -1;
+
+TEST(ArrayRangeTest, InsertRangeRollsBackOnThrow) {
+    {
+        std::vector<ThrowingCopy> batch = {10, 11, 12, 13};
+        BasicMass<ThrowingCopy> m;
+        for (int i = 0; i < 5; ++i) m.push_back(ThrowingCopy(i));
+        ThrowingCopy::copies_left = 2;
+        EXPECT_THROW(m.insert_range(2, batch.begin(), batch.end()), std::runtime_error);
+        ThrowingCopy::copies_left = -1;
+        ASSERT_EQ(m.get_size(), 5);
+        for (int i = 0; i < 5; ++i) EXPECT_EQ(m[i].value, i);
+        EXPECT_EQ(ThrowingCopy::live, 9);
+
+        ThrowingCopy::copies_left = 0; // бросает и при переезде в новый буфер
+        EXPECT_THROW(m.insert_range(5, batch.begin(), batch.end()), std::runtime_error);
+        ThrowingCopy::copies_left = -1;
+        ASSERT_EQ(m.get_size(), 5);
+        EXPECT_EQ(m[4].value, 4);
+    }
+    EXPECT_EQ(ThrowingCopy::live, 0);
+}
+
+TEST(ArrayRangeTest, EraseRange) {
+    Mass m;
+    for (int i = 0; i < 10; ++i) m.push_back(std::to_string(i));
+    m.erase_range(2, 5);
+    ASSERT_EQ(m.get_size(), 7);
+    EXPECT_EQ(m.get_at(1), "1");
+    EXPECT_EQ(m.get_at(2), "5");
+    EXPECT_EQ(m.get_at(6), "9");
+    m.erase_range(5, 7);
+    EXPECT_EQ(m.get_size(), 5);
+    EXPECT_EQ(m.get_at(4), "7");
+    // некорректные и пустые диапазоны
+    m.erase_range(-1, 2);
+    m.erase_range(3, 3);
+    m.erase_range(4, 2);
+    m.erase_range(0, 6);
+    EXPECT_EQ(m.get_size(), 5);
+    m.erase_range(0, 5);
+    EXPECT_TRUE(m.is_empty());
+}
+
+TEST(ArrayRangeTest, AppendOtherAndSelf) {
+    Mass a, b;
+    a.push_back("a0");
+    b.push_back("b0");
+    b.push_back("b1");
+    a.append(b);
+    ASSERT_EQ(a.get_size(), 3);
+    EXPECT_EQ(a.get_at(2), "b1");
+    a.append(a);
+    ASSERT_EQ(a.get_size(), 6);
+    EXPECT_EQ(a.get_at(3), "a0");
+    EXPECT_EQ(a.get_at(5), "b1");
+    Mass empty;
+    a.append(empty);
+    EXPECT_EQ(a.get_size(), 6);
+}
+
+// Тесты PoolMass (строки в общей арене)
+TEST(PoolMassTest, PushBackAndGet) {
+    PoolMass p;
+    EXPECT_TRUE(p.is_empty());
+    p.push_back("alpha");
+    p.push_back("");
+    p.push_back(std::string(100, 'z'));
+    EXPECT_EQ(p.get_size(), 3);
+    EXPECT_EQ(p.get_at(0), "alpha");
+    EXPECT_EQ(p.get_at(1), "");
+    EXPECT_EQ(p.get_at(2), std::string(100, 'z'));
+    EXPECT_EQ(p.get_at(-1), "");
+    EXPECT_EQ(p.get_at(3), "");
+    EXPECT_EQ(p.bytes_used(), 105u);
+}
+
+TEST(PoolMassTest, InsertDeleteReplace) {
+    PoolMass p;
+    p.push_back("b");
+    p.insert_at(0, "a");
+    p.insert_at(2, "c");
+    p.insert_at(5, "bad");
+    ASSERT_EQ(p.get_size(), 3);
+    EXPECT_EQ(p.get_at(0), "a");
+    EXPECT_EQ(p.get_at(2), "c");
+
+    p.replace_at(1, "bbbbbb"); // длиннее — новое место в арене
+    p.replace_at(0, "");       // короче — на месте
+    p.replace_at(7, "bad");
+    EXPECT_EQ(p.get_at(0), "");
+    EXPECT_EQ(p.get_at(1), "bbbbbb");
+
+    p.del_at(2);
+    p.del_at(-1);
+    EXPECT_EQ(p.get_size(), 2);
+    EXPECT_EQ(p.bytes_used(), 6u);
+    p.compact();
+    EXPECT_EQ(p.get_at(1), "bbbbbb");
+    EXPECT_EQ(p.bytes_used(), 6u);
+}
+
+TEST(PoolMassTest, PushBackOwnElementSurvivesGrowth) {
+    PoolMass p;
+    p.push_back("self");
+    for (int i = 0; i < 20; ++i) p.push_back(p.get_at(i));
+    EXPECT_EQ(p.get_size(), 21);
+    EXPECT_EQ(p.get_at(20), "self");
+    p.replace_at(0, p.get_at(5));
+    EXPECT_EQ(p.get_at(0), "self");
+}
+
+TEST(PoolMassTest, SerializationCompatibleWithMass) {
+    Mass m;
+    m.push_back("one");
+    m.push_back("two");
+    std::stringstream ss;
+    m.serialize(ss);
+
+    PoolMass p;
+    p.push_back("stale");
+    p.deserialize(ss);
+    ASSERT_EQ(p.get_size(), 2);
+    EXPECT_EQ(p.get_at(1), "two");
+
+    std::stringstream back;
+    p.serialize(back);
+    Mass restored;
+    restored.deserialize(back);
+    EXPECT_EQ(restored.get_at(0), "one");
+
+    testing::internal::CaptureStdout();
+    p.print();
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "one two \n");
+}
+
+// Тесты доступа без копирования и итераторов
+TEST(ArrayIteratorTest, ReferenceAccessors) {
+    Mass m;
+    m.push_back("a");
+    m.push_back("b");
+    m[0] += "!";
+    const Mass &cm = m;
+    EXPECT_EQ(cm[0], "a!");
+    EXPECT_EQ(&cm[1], m.data() + 1);
+    EXPECT_EQ(m.view_at(1), "b");
+    EXPECT_EQ(m.view_at(2), "");
+    EXPECT_EQ(m.view_at(-1), "");
+}
+
+TEST(ArrayIteratorTest, RangeForAndAlgorithms) {
+    Mass m;
+    EXPECT_EQ(m.begin(), m.end());
+    for (int i = 0; i < 10; ++i) m.push_back(std::to_string(i));
+
+    std::string joined;
+    for (const std::string &s : m) joined += s;
+    EXPECT_EQ(joined, "0123456789");
+
+    auto it = std::find(m.begin(), m.end(), "7");
+    ASSERT_NE(it, m.end());
+    EXPECT_EQ(it - m.begin(), 7);
+
+    std::reverse(m.begin(), m.end());
+    EXPECT_EQ(m.get_at(0), "9");
+    size_t total = std::accumulate(m.cbegin(), m.cend(), size_t(0),
+        [](size_t acc, const std::string &s) { return acc + s.size(); });
+    EXPECT_EQ(total, 10u);
+}
+
+// Тесты сортировки и бинарного поиска
+TEST(ArraySortTest, SortAndSearch) {
+    Mass m;
+    const char *vals[] = {"pear", "apple", "fig", "kiwi", "banana"};
+    for (const char *v : vals) m.push_back(v);
+    m.sort();
+    EXPECT_TRUE(std::is_sorted(m.begin(), m.end()));
+    EXPECT_EQ(m.get_at(0), "apple");
+    EXPECT_EQ(m.lower_bound("fig"), 2);
+    EXPECT_EQ(m.lower_bound("zzz"), 5);
+    EXPECT_EQ(m.lower_bound(""), 0);
+    EXPECT_TRUE(m.binary_search("kiwi"));
+    EXPECT_FALSE(m.binary_search("grape"));
+}
+
+TEST(ArraySortTest, StableSortAndEmpty) {
+    Mass empty;
+    empty.sort();
+    empty.stable_sort();
+    empty.parallel_sort(4);
+    EXPECT_TRUE(empty.is_empty());
+    EXPECT_FALSE(empty.binary_search("x"));
+
+    Mass m;
+    for (int i = 9; i >= 0; --i) m.push_back(std::to_string(i % 3));
+    m.stable_sort();
+    EXPECT_EQ(m.get_at(0), "0");
+    EXPECT_EQ(m.get_at(9), "2");
+}
+
+TEST(ArraySortTest, ParallelSortMatchesSequential) {
+    for (int threads : {0, 1, 2, 3, 5, 7, 8, 12}) {
+        Mass par;
+        std::vector<std::string> expected;
+        unsigned seed = 12345;
+        for (int i = 0; i < 100000; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            std::string v = "key_" + std::to_string(seed % 50000);
+            par.push_back(v);
+            expected.push_back(v);
+        }
+        std::sort(expected.begin(), expected.end());
+        par.parallel_sort(threads);
+        ASSERT_EQ(par.get_size(), 100000);
+        for (int i = 0; i < par.get_size(); ++i) {
+            ASSERT_EQ(par[i], expected[i]) << "threads=" << threads << " i=" << i;
+        }
+    }
+}
+
+// Много равных ключей: разрезы co_rank попадают внутрь серий дубликатов
+TEST(ArraySortTest, ParallelSortDuplicatesAndInts) {
+    Mass par;
+    for (int i = 0; i < 60000; ++i) par.push_back(std::to_string(i % 3));
+    par.parallel_sort(6);
+    EXPECT_EQ(par.count("0"), 20000);
+    EXPECT_EQ(par.find("1"), 20000);
+    EXPECT_EQ(par.find("2"), 40000);
+    EXPECT_TRUE(std::is_sorted(std::as_const(par).begin(), std::as_const(par).end()));
+
+    BasicMass<int> ints;
+    for (int i = 0; i < 50000; ++i) ints.push_back((i * 7919) % 50000);
+    ints.parallel_sort(4);
+    for (int i = 0; i < 50000; ++i) ASSERT_EQ(ints[i], i);
+}
+
+// Тесты сегментированного массива
+TEST(SegMassTest, MatchesMassOnRandomEdits) {
+    SegMass seg(8);
+    Mass ref;
+    unsigned seed = 7;
+    for (int step = 0; step < 3000; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        int op = (seed >> 16) % 4;
+        int pos = ref.get_size() == 0 ? 0 : static_cast<int>((seed >> 8) % (ref.get_size() + 1));
+        std::string val = "v" + std::to_string(step);
+        if (op < 2 || ref.get_size() == 0) {
+            seg.insert_at(pos, val);
+            ref.insert_at(pos, val);
+        } else if (op == 2) {
+            seg.del_at(pos);
+            ref.del_at(pos);
+        } else {
+            seg.replace_at(pos, val);
+            ref.replace_at(pos, val);
+        }
+        ASSERT_EQ(seg.get_size(), ref.get_size());
+    }
+    for (int i = 0; i < ref.get_size(); ++i) {
+        ASSERT_EQ(seg.get_at(i), ref.get_at(i)) << "i=" << i;
+    }
+    EXPECT_GT(seg.get_block_count(), 1);
+}
+
+TEST(SegMassTest, InvalidIndicesAndEmpty) {
+    SegMass seg;
+    EXPECT_TRUE(seg.is_empty());
+    EXPECT_EQ(seg.get_at(0), "");
+    EXPECT_EQ(seg.view_at(0), "");
+    seg.del_at(0);
+    seg.replace_at(0, "x");
+    seg.insert_at(1, "x");
+    EXPECT_EQ(seg.get_size(), 0);
+    seg.push_back("a");
+    seg.insert_at(-1, "x");
+    seg.del_at(1);
+    EXPECT_EQ(seg.get_size(), 1);
+    EXPECT_EQ(seg.view_at(0), "a");
+    seg.del_at(0);
+    EXPECT_TRUE(seg.is_empty());
+    EXPECT_EQ(seg.get_block_count(), 0);
+}
+
+TEST(SegMassTest, PushBackFillsBlocks) {
+    SegMass seg(8);
+    for (int i = 0; i < 100; ++i) seg.push_back(std::to_string(i));
+    EXPECT_EQ(seg.get_block_count(), 13);
+    for (int i = 0; i < 100; ++i) ASSERT_EQ(seg.get_at(i), std::to_string(i));
+    seg.insert_at(50, "mid");
+    EXPECT_EQ(seg.get_at(50), "mid");
+    EXPECT_EQ(seg.get_at(51), "50");
+    EXPECT_EQ(seg.get_at(100), "99");
+}
+
+TEST(SegMassTest, SerializationCompatibleWithMass) {
+    SegMass seg(4);
+    for (int i = 0; i < 10; ++i) seg.push_back("s" + std::to_string(i));
+    std::stringstream ss;
+    seg.serialize(ss);
+    Mass m;
+    m.deserialize(ss);
+    ASSERT_EQ(m.get_size(), 10);
+    EXPECT_EQ(m.get_at(9), "s9");
+
+    std::stringstream back;
+    m.serialize(back);
+    SegMass restored(4);
+    restored.push_back("stale");
+    restored.deserialize(back);
+    ASSERT_EQ(restored.get_size(), 10);
+    EXPECT_EQ(restored.get_block_count(), 3);
+    restored.insert_at(5, "mid");
+    EXPECT_EQ(restored.get_at(5), "mid");
+    EXPECT_EQ(restored.get_at(6), "s5");
+
+    testing::internal::CaptureStdout();
+    restored.print();
+    std::string out = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(out.substr(0, 6), "s0 s1 ");
+}
+
+// Тесты поиска с отсевом по длине
+TEST(ArraySearchTest, FindCountFindAll) {
+    Mass m;
+    const char *vals[] = {"abc", "abcd", "ab", "abc", "", "xbc", "abc", "abcde",
+                          "a", "abc", "zz"};
+    for (const char *v : vals) m.push_back(v);
+    EXPECT_EQ(m.find("abc"), 0);
+    EXPECT_EQ(m.count("abc"), 4);
+    EXPECT_EQ(m.find_all("abc"), (std::vector<int>{0, 3, 6, 9}));
+    EXPECT_EQ(m.find(""), 4);
+    EXPECT_EQ(m.find("abcdef"), -1);
+    EXPECT_EQ(m.count("q"), 0);
+    EXPECT_EQ(m.find_prefix("abc"), (std::vector<int>{0, 1, 3, 6, 7, 9}));
+    EXPECT_EQ(m.find_prefix("abcd"), (std::vector<int>{1, 7}));
+    EXPECT_EQ(m.find_prefix("").size(), 11u);
+}
+
+TEST(ArraySearchTest, LongKeysSharingHeads) {
+    Mass m;
+    for (int i = 0; i < 100; ++i) m.push_back("prefix_common_" + std::to_string(i % 10));
+    EXPECT_EQ(m.count("prefix_common_7"), 10);
+    EXPECT_EQ(m.find("prefix_common_7"), 7);
+    EXPECT_EQ(m.find_prefix("prefix_common_").size(), 100u);
+    EXPECT_EQ(m.find_prefix("prefix_x").size(), 0u);
+}
+
+// Запись через ссылку или итератор, сохранённые дольше одного поиска
+TEST(ArraySearchTest, RetainedReferenceAndIterator) {
+    Mass m;
+    for (const char *v : {"a", "b", "c", "d"}) m.push_back(v);
+    EXPECT_TRUE(m.is_search_indexed());
+    auto &r = m[1];
+    EXPECT_FALSE(m.is_search_indexed());
+    EXPECT_EQ(m.find("b"), 1);
+    r = "zzz";
+    EXPECT_EQ(m.find("zzz"), 1);
+    EXPECT_EQ(m.find("b"), -1);
+
+    auto it = m.begin();
+    EXPECT_EQ(m.find("q"), -1);
+    *it = "hello";
+    EXPECT_EQ(m.find("hello"), 0);
+    EXPECT_EQ(m.count("hello"), 1);
+    EXPECT_EQ(m.find_all("zzz"), (std::vector<int>{1}));
+    EXPECT_EQ(m.find_prefix("hel"), (std::vector<int>{0}));
+
+    m.emplace_back("e") = "edited";
+    EXPECT_EQ(m.find("edited"), 4);
+
+    // Явный возврат отсева; дальнейшие правки через API он отслеживает
+    m.rebuild_search_index();
+    EXPECT_TRUE(m.is_search_indexed());
+    EXPECT_EQ(m.find("edited"), 4);
+    m.replace_at(4, "x");
+    m.push_back("y");
+    EXPECT_EQ(m.find("x"), 4);
+    EXPECT_EQ(m.find("y"), 5);
+    EXPECT_EQ(m.find("edited"), -1);
+}
+
+TEST(ArraySearchTest, IndexFollowsMutations) {
+    Mass m;
+    for (int i = 0; i < 20; ++i) m.push_back(std::to_string(i));
+    EXPECT_EQ(m.find("5"), 5);
+    m.push_back("5");                 // индекс дополняется
+    EXPECT_EQ(m.count("5"), 2);
+    m.replace_at(5, "five");          // индекс обновляется на месте
+    EXPECT_EQ(m.find("5"), 20);
+    EXPECT_EQ(m.find("five"), 5);
+    m.insert_at(0, "five");           // записи индекса сдвигаются
+    EXPECT_EQ(m.find_all("five"), (std::vector<int>{0, 6}));
+    m.del_at(0);
+    m[1] = "five";                    // изменение по ссылке
+    EXPECT_EQ(m.find("five"), 1);
+    for (std::string &s : m) s += "!";
+    EXPECT_EQ(m.find("five"), -1);
+    EXPECT_EQ(m.find("five!"), 1);
+    m.sort();
+    EXPECT_EQ(m.find_prefix("five").size(), 2u);
+    EXPECT_FALSE(m.is_search_indexed());
+    m.rebuild_search_index();
+    std::vector<std::string> batch = {"five!", "q"};
+    m.insert_range(3, batch.begin(), batch.end());
+    m.erase_range(0, 2);
+    m.append(m);
+    EXPECT_TRUE(m.is_search_indexed());
+    EXPECT_EQ(m.count("five!"), 6);
+    EXPECT_EQ(m.find_all("q"), (std::vector<int>{2, 23}));
+    m.sort();
+    EXPECT_EQ(m.find_all("q").size(), 2u);
+    EXPECT_EQ(m.find_prefix("1"), m.find_prefix("1"));
+}
+
+// Константный поиск ничего не строит и не пишет: вызовы из разных
+// потоков на одном массиве не мешают друг другу
+TEST(ArraySearchTest, ConstSearchFromManyThreads) {
+    Mass m;
+    for (int i = 0; i < 20000; ++i) m.push_back("k" + std::to_string(i % 100));
+    m.sort();
+    const Mass &view = m;
+    std::vector<int> counts(4), firsts(4);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&view, &counts, &firsts, t] {
+            for (int r = 0; r < 20; ++r) {
+                counts[t] = view.count("k42");
+                firsts[t] = view.find("k7");
+            }
+        });
+    }
+    for (std::thread &t : readers) t.join();
+    for (int t = 0; t < 4; ++t) {
+        EXPECT_EQ(counts[t], 200);
+        EXPECT_EQ(firsts[t], m.find("k7"));
+    }
+}
+
+// Тесты шаблонного массива для тривиально копируемых типов
+struct Record {
+    int id;
+    double value;
+    char tag[8];
+};
+
+TEST(BasicMassTest, IntGrowthInsertDelete) {
+    BasicMass<int> m;
+    for (int i = 0; i < 100; ++i) m.push_back(i);
+    m.insert_at(0, -1);
+    m.insert_at(50, 1000);
+    m.del_at(10);
+    ASSERT_EQ(m.get_size(), 101);
+    EXPECT_EQ(m.get_at(0), -1);
+    EXPECT_EQ(m.get_at(9), 8);
+    EXPECT_EQ(m.get_at(10), 10);
+    EXPECT_EQ(m.get_at(49), 1000);
+    EXPECT_EQ(m.get_at(500), 0);
+
+    std::vector<int> batch = {7, 8, 9};
+    m.insert_range(1, batch.begin(), batch.end());
+    m.erase_range(4, 14);
+    EXPECT_EQ(m.get_at(3), 9);
+    EXPECT_EQ(m.get_at(4), 11);
+    m.append(m);
+    EXPECT_EQ(m.get_size(), 188);
+    EXPECT_EQ(m.find(1000), 42);
+    EXPECT_EQ(m.count(1000), 2);
+    m.parallel_sort(2);
+    EXPECT_TRUE(std::is_sorted(m.begin(), m.end()));
+    EXPECT_TRUE(m.binary_search(99));
+}
+
+TEST(BasicMassTest, TrivialSerializationIsOneBlock) {
+    BasicMass<Record> m;
+    for (int i = 0; i < 10; ++i) {
+        Record r{i, i * 1.5, "rec"};
+        m.push_back(r);
+    }
+    std::stringstream ss;
+    m.serialize(ss);
+    EXPECT_EQ(ss.str().size(), sizeof(int) + 10 * sizeof(Record));
+
+    BasicMass<Record> restored;
+    restored.push_back(Record{99, 0, "old"});
+    restored.deserialize(ss);
+    ASSERT_EQ(restored.get_size(), 10);
+    EXPECT_EQ(restored[7].id, 7);
+    EXPECT_DOUBLE_EQ(restored[7].value, 10.5);
+    EXPECT_STREQ(restored[7].tag, "rec");
+
+    std::stringstream empty_ss;
+    BasicMass<int>().serialize(empty_ss);
+    BasicMass<int> empty;
+    empty.push_back(1);
+    empty.deserialize(empty_ss);
+    EXPECT_TRUE(empty.is_empty());
+}
+
+TEST(BasicMassTest, PrintAndReadInts) {
+    BasicMass<int> m;
+    std::streambuf* orig_cin = std::cin.rdbuf();
+    std::istringstream input("3\n4 5 6\n");
+    std::cin.rdbuf(input.rdbuf());
+    testing::internal::CaptureStdout();
+    m.read();
+    std::cin.rdbuf(orig_cin);
+    testing::internal::GetCapturedStdout();
+    ASSERT_EQ(m.get_size(), 3);
+    EXPECT_EQ(m.get_at(2), 6);
+
+    testing::internal::CaptureStdout();
+    m.print();
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "4 5 6 \n");
+}
+
+// Тесты аллокатора и политики роста/сжатия
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    int *allocations;
+    explicit CountingAllocator(int *counter) : allocations(counter) {}
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U> &other) : allocations(other.allocations) {}
+    T *allocate(std::size_t n) {
+        ++*allocations;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) {
+        --*allocations;
+        std::allocator<T>().deallocate(p, n);
+    }
+};
+
+// Запоминает самый большой запрос и отказывает сверх limit
+template <typename T>
+struct LimitedAllocator {
+    using value_type = T;
+    std::size_t *largest;
+    std::size_t limit;
+    LimitedAllocator(std::size_t *largest, std::size_t limit) : largest(largest), limit(limit) {}
+    template <typename U>
+    LimitedAllocator(const LimitedAllocator<U> &other) : largest(other.largest), limit(other.limit) {}
+    T *allocate(std::size_t n) {
+        if (n > *largest) *largest = n;
+        if (n > limit) throw std::bad_alloc();
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+};
+
+// capacity * growth_factor сверх INT_MAX обрезается, а не переполняет int
+TEST(ArrayAllocTest, HugeGrowthFactorIsClamped) {
+    std::size_t largest = 0;
+    BasicMass<int, LimitedAllocator<int>> m{LimitedAllocator<int>(&largest, 1 << 20)};
+    m.set_growth_factor(1e12);
+    for (int i = 0; i < 4; ++i) m.push_back(i);
+    EXPECT_EQ(m.get_capacity(), 4);
+    EXPECT_THROW(m.push_back(4), std::bad_alloc);
+    EXPECT_EQ(largest, static_cast<std::size_t>(std::numeric_limits<int>::max()));
+    ASSERT_EQ(m.get_size(), 4);
+    EXPECT_EQ(m[3], 3);
+
+    // Сжатие с тем же коэффициентом: цель не меньше ёмкости — буфер остаётся
+    BasicMass<int> sparse;
+    sparse.reserve(64);
+    for (int i = 0; i < 40; ++i) sparse.push_back(i);
+    sparse.set_growth_factor(1e12);
+    sparse.set_shrink_threshold(0.5);
+    sparse.erase_range(1, 40);
+    EXPECT_EQ(sparse.get_capacity(), 64);
+    EXPECT_EQ(sparse.get_at(0), 0);
+}
+
+// Поток без позиционирования: tellg/seekg не работают, как у сокета или cin
+struct ForwardOnlyBuf : std::streambuf {
+    std::string bytes;
+    explicit ForwardOnlyBuf(std::string b) : bytes(std::move(b)) {
+        setg(&bytes[0], &bytes[0], &bytes[0] + bytes.size());
+    }
+};
+
+static std::string raw_int(int v) {
+    return std::string(reinterpret_cast<const char *>(&v), sizeof(int));
+}
+
+// Размеры из битого заголовка не превращаются в огромные выделения
+TEST(ArrayAllocTest, DeserializeDoesNotTrustHeaderSizes) {
+    std::size_t largest = 0;
+    using LimitedMass = BasicMass<std::string, LimitedAllocator<std::string>>;
+    std::string records = raw_int(2) + "ab" + raw_int(1) + "c";
+    for (bool seekable : {true, false}) {
+        LimitedMass m{LimitedAllocator<std::string>(&largest, 1 << 17)};
+        std::string data = raw_int(std::numeric_limits<int>::max()) + records;
+        ForwardOnlyBuf buf(data);
+        std::istream forward(&buf);
+        std::istringstream seek(data);
+        m.deserialize(seekable ? static_cast<std::istream &>(seek) : forward);
+        ASSERT_EQ(m.get_size(), 2) << "seekable=" << seekable;
+        EXPECT_EQ(m.get_at(0), "ab");
+        EXPECT_EQ(m.get_at(1), "c");
+    }
+    EXPECT_LE(largest, static_cast<std::size_t>(1 << 16));
+
+    // Длина строки больше остатка потока или отрицательная — чтение обрывается
+    for (int len : {std::numeric_limits<int>::max(), -5}) {
+        Mass m;
+        std::istringstream seek(raw_int(3) + raw_int(1) + "x" + raw_int(len) + "tail");
+        m.deserialize(seek);
+        ASSERT_EQ(m.get_size(), 1);
+        EXPECT_EQ(m.get_at(0), "x");
+        ForwardOnlyBuf buf(raw_int(3) + raw_int(1) + "x" + raw_int(len) + "tail");
+        std::istream forward(&buf);
+        m.deserialize(forward);
+        ASSERT_EQ(m.get_size(), 1);
+        EXPECT_EQ(m.get_at(0), "x");
+    }
+
+    largest = 0;
+    for (bool seekable : {true, false}) {
+        BasicMass<int, LimitedAllocator<int>> ints{LimitedAllocator<int>(&largest, 1 << 17)};
+        std::string data = raw_int(std::numeric_limits<int>::max()) + raw_int(7) + raw_int(8) + raw_int(9);
+        ForwardOnlyBuf buf(data);
+        std::istream forward(&buf);
+        std::istringstream seek(data);
+        ints.deserialize(seekable ? static_cast<std::istream &>(seek) : forward);
+        ASSERT_EQ(ints.get_size(), 3) << "seekable=" << seekable;
+        EXPECT_EQ(ints[2], 9);
+    }
+    EXPECT_LE(largest, static_cast<std::size_t>(1 << 16));
+
+    // Длинная строка из непозиционируемого потока читается кусками целиком
+    std::string big(200000, 'z');
+    ForwardOnlyBuf buf(raw_int(1) + raw_int(static_cast<int>(big.size())) + big);
+    std::istream forward(&buf);
+    Mass m;
+    m.deserialize(forward);
+    ASSERT_EQ(m.get_size(), 1);
+    EXPECT_EQ(m.get_at(0), big);
+}
+
+TEST(ArrayAllocTest, GrowthFactorAndShrinkToFit) {
+    Mass m;
+    m.set_growth_factor(1.5);
+    m.set_growth_factor(0.5); // игнорируется
+    for (int i = 0; i < 5; ++i) m.push_back("x");
+    EXPECT_EQ(m.get_capacity(), 6);
+    for (int i = 0; i < 2; ++i) m.push_back("y");
+    EXPECT_EQ(m.get_capacity(), 9);
+    m.shrink_to_fit();
+    EXPECT_EQ(m.get_capacity(), 7);
+    EXPECT_EQ(m.get_at(6), "y");
+    while (!m.is_empty()) m.del_at(0);
+    m.shrink_to_fit();
+    EXPECT_EQ(m.get_capacity(), 0);
+    m.push_back("again");
+    EXPECT_EQ(m.get_capacity(), 4);
+}
+
+TEST(ArrayAllocTest, AutomaticShrinkAfterDelete) {
+    BasicMass<int> m;
+    for (int i = 0; i < 1000; ++i) m.push_back(i);
+    EXPECT_EQ(m.get_capacity(), 1024);
+    m.del_at(0);
+    EXPECT_EQ(m.get_capacity(), 1024); // порог по умолчанию выключен
+
+    m.set_shrink_threshold(0.25);
+    m.set_shrink_threshold(1.5); // игнорируется
+    m.erase_range(0, 800);
+    EXPECT_EQ(m.get_size(), 199);
+    EXPECT_EQ(m.get_capacity(), 398);
+    EXPECT_EQ(m.get_at(0), 801);
+    while (m.get_size() > 1) m.del_at(m.get_size() - 1);
+    EXPECT_LE(m.get_capacity(), 8);
+    EXPECT_EQ(m.get_at(0), 801);
+}
+
+TEST(ArrayAllocTest, CustomAllocatorIsUsed) {
+    int live = 0;
+    {
+        BasicMass<std::string, CountingAllocator<std::string>> m{CountingAllocator<std::string>(&live)};
+        for (int i = 0; i < 100; ++i) m.push_back(std::to_string(i));
+        EXPECT_EQ(live, 1);
+        EXPECT_EQ(m.get_at(99), "99");
+        EXPECT_EQ(m.find("42"), 42);
+    }
+    EXPECT_EQ(live, 0);
+}
+
+TEST(ArrayAllocTest, MonotonicArena) {
+    std::pmr::monotonic_buffer_resource arena;
+    BasicMass<int, std::pmr::polymorphic_allocator<int>> m(&arena);
+    for (int i = 0; i < 10000; ++i) m.push_back(i);
+    EXPECT_EQ(m.get_allocator().resource(), &arena);
+    EXPECT_EQ(m.get_at(9999), 9999);
+
+    BasicMass<std::string, std::pmr::polymorphic_allocator<std::string>> strings(&arena);
+    strings.push_back("on arena");
+    strings.insert_at(0, "first");
+    EXPECT_EQ(strings.get_at(1), "on arena");
+}
+
 // ===== BENCHMARKS =====
 TEST(ArrayBench, BENCHMARK_Array_PushBack) {
     auto start = std::chrono::high_resolution_clock::now();
@@ -474,4 +1294,260 @@ TEST(ArrayBench, BENCHMARK_Array_InsertAt) {
     auto end = std::chrono::high_resolution_clock::now();
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
     std::cout << "\ninsert_at x500: " << ms << " ms\n";
-}
\ No newline at end of file
+}
+
+TEST(ArrayBench, BENCHMARK_Array_PushBackMoveLong) {
+    auto start = std::chrono::high_resolution_clock::now();
+    Mass m;
+    for (int i = 0; i < 1000000; ++i) m.push_back(std::string(64, 'x'));
+    auto end = std::chrono::high_resolution_clock::now();
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    std::cout << "\npush_back(&&) x1000000 (64 байта): " << ms << " ms\n";
+    EXPECT_EQ(m.get_size(), 1000000);
+}
+
+TEST(ArrayBench, BENCHMARK_Array_InsertRangeVsLoop) {
+    std::vector<std::string> batch;
+    for (int i = 0; i < 2000; ++i) batch.push_back("batch_" + std::to_string(i));
+
+    Mass loop;
+    Mass ranged;
+    for (int i = 0; i < 20000; ++i) {
+        loop.push_back("elem_" + std::to_string(i));
+        ranged.push_back("elem_" + std::to_string(i));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 2000; ++i) loop.insert_at(10000 + i, batch[i]);
+    auto mid = std::chrono::high_resolution_clock::now();
+    ranged.insert_range(10000, batch.begin(), batch.end());
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto loop_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto range_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count();
+    std::cout << "\ninsert_at x2000: " << loop_ms << " ms, insert_range(2000): " << range_ms << " ms\n";
+    EXPECT_EQ(loop.get_size(), ranged.get_size());
+}
+
+TEST(ArrayBench, BENCHMARK_Array_EraseRangeVsLoop) {
+    Mass loop;
+    Mass ranged;
+    for (int i = 0; i < 22000; ++i) {
+        loop.push_back("elem_" + std::to_string(i));
+        ranged.push_back("elem_" + std::to_string(i));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 2000; ++i) loop.del_at(10000);
+    auto mid = std::chrono::high_resolution_clock::now();
+    ranged.erase_range(10000, 12000);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto loop_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto range_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count();
+    std::cout << "\ndel_at x2000: " << loop_ms << " ms, erase_range(2000): " << range_ms << " ms\n";
+    EXPECT_EQ(loop.get_size(), ranged.get_size());
+}
+
+TEST(ArrayBench, BENCHMARK_PoolMass_VsMass) {
+    const int N = 1000000;
+    std::string val(40, 'p');
+
+    auto start = std::chrono::high_resolution_clock::now();
+    Mass m;
+    for (int i = 0; i < N; ++i) m.push_back(val);
+    size_t total = 0;
+    for (int i = 0; i < N; ++i) total += m.get_at(i).size();
+    auto mid = std::chrono::high_resolution_clock::now();
+    PoolMass p;
+    for (int i = 0; i < N; ++i) p.push_back(val);
+    size_t pool_total = 0;
+    for (int i = 0; i < N; ++i) pool_total += p.get_at(i).size();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto mass_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto pool_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count();
+    std::cout << "\nMass push+scan x" << N << ": " << mass_ms << " ms, PoolMass: " << pool_ms << " ms\n";
+    std::cout << "PoolMass memory: " << p.memory_usage() / 1024 << " KiB, Mass (оценка): "
+              << (N * (sizeof(std::string) + val.size() + 1)) / 1024 << " KiB\n";
+    EXPECT_EQ(total, pool_total);
+}
+
+TEST(ArrayBench, BENCHMARK_Array_ScanGetAtVsIterators) {
+    const int N = 1000000;
+    Mass m;
+    for (int i = 0; i < N; ++i) m.push_back(std::string(32, 'a' + i % 26));
+
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t by_copy = 0;
+    for (int i = 0; i < m.get_size(); ++i) by_copy += m.get_at(i).size();
+    auto mid = std::chrono::high_resolution_clock::now();
+    size_t by_iter = 0;
+    for (const std::string &s : m) by_iter += s.size();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto copy_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto iter_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count();
+    std::cout << "\nscan x" << N << " get_at: " << copy_ms << " ms, iterators: " << iter_ms << " ms\n";
+    EXPECT_EQ(by_copy, by_iter);
+}
+
+TEST(ArrayBench, BENCHMARK_Array_SortVsParallelSort) {
+    const int N = 1000000;
+    Mass seq;
+    Mass par;
+    unsigned seed = 42;
+    for (int i = 0; i < N; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        std::string v = "key_" + std::to_string(seed);
+        seq.push_back(v);
+        par.push_back(std::move(v));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    seq.sort();
+    auto mid = std::chrono::high_resolution_clock::now();
+    par.parallel_sort();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto seq_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto par_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count();
+    std::cout << "\nsort x" << N << ": " << seq_ms << " ms, parallel_sort (" << std::thread::hardware_concurrency()
+              << " потоков): " << par_ms << " ms\n";
+    EXPECT_TRUE(std::is_sorted(par.begin(), par.end()));
+}
+
+// Рост ускорения с числом потоков; выше числа ядер время не падает
+TEST(ArrayBench, BENCHMARK_Array_ParallelSortScaling) {
+    const int N = 2000000;
+    std::vector<std::string> source;
+    unsigned seed = 7;
+    for (int i = 0; i < N; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        source.push_back("key_" + std::to_string(seed));
+    }
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    long long base_ms = 0;
+    for (int threads = 1; threads <= static_cast<int>(2 * cores) && threads <= 32; threads *= 2) {
+        Mass m;
+        m.insert_range(0, source.begin(), source.end());
+        auto start = std::chrono::high_resolution_clock::now();
+        m.parallel_sort(threads);
+        auto end = std::chrono::high_resolution_clock::now();
+        long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        if (threads == 1) base_ms = ms;
+        std::cout << (threads == 1 ? "\n" : "") << "parallel_sort x" << N << ", " << threads
+                  << " потоков (ядер: " << cores << "): " << ms << " ms, ускорение "
+                  << (ms > 0 ? static_cast<double>(base_ms) / ms : 0.0) << "\n";
+        EXPECT_TRUE(std::is_sorted(std::as_const(m).begin(), std::as_const(m).end()));
+    }
+}
+
+TEST(ArrayBench, BENCHMARK_SegMass_RandomInsertDelete) {
+    const int N = 50000;
+    const int OPS = 2000;
+    Mass m;
+    SegMass seg;
+    for (int i = 0; i < N; ++i) {
+        m.push_back("elem_" + std::to_string(i));
+        seg.push_back("elem_" + std::to_string(i));
+    }
+
+    unsigned seed = 99;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < OPS; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        m.insert_at(seed % N, "x");
+        m.del_at((seed >> 4) % N);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    seed = 99;
+    for (int i = 0; i < OPS; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        seg.insert_at(seed % N, "x");
+        seg.del_at((seed >> 4) % N);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto mass_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto seg_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count();
+    std::cout << "\nrandom insert+del x" << OPS << " on " << N << ": Mass " << mass_ms
+              << " ms, SegMass " << seg_ms << " ms\n";
+    EXPECT_EQ(m.get_at(N / 2), seg.get_at(N / 2));
+}
+
+TEST(ArrayBench, BENCHMARK_Array_FindAllHitRates) {
+    const int N = 1000000;
+    const std::string key = "needle_key_42";
+    for (int hit_percent : {0, 1, 10, 50, 100}) {
+        Mass m;
+        for (int i = 0; i < N; ++i) {
+            if (i % 100 < hit_percent) m.push_back(key);
+            else m.push_back("hay_" + std::to_string(i % 1000));
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        int naive = 0;
+        for (int i = 0; i < m.get_size(); ++i) {
+            if (m.get_at(i) == key) ++naive;
+        }
+        auto mid = std::chrono::high_resolution_clock::now();
+        int fast = m.count(key);
+        auto after_fast = std::chrono::high_resolution_clock::now();
+        // Неконстантный доступ раскрывает массив: отсев выключается до
+        // rebuild_search_index(), и count идёт полным проходом
+        m.data();
+        EXPECT_FALSE(m.is_search_indexed());
+        int exposed = m.count(key);
+        auto after_exposed = std::chrono::high_resolution_clock::now();
+        m.rebuild_search_index();
+        auto end = std::chrono::high_resolution_clock::now();
+
+        auto naive_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+        auto fast_ms = std::chrono::duration_cast<std::chrono::milliseconds>(after_fast - mid).count();
+        auto exposed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(after_exposed - after_fast).count();
+        auto rebuild_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - after_exposed).count();
+        std::cout << "\ncount x" << N << " hit " << hit_percent << "%: get_at loop " << naive_ms
+                  << " ms, count " << fast_ms << " ms, count раскрытого " << exposed_ms
+                  << " ms, rebuild_search_index " << rebuild_ms << " ms\n";
+        EXPECT_EQ(naive, fast);
+        EXPECT_EQ(fast, exposed);
+        EXPECT_EQ(fast, m.count(key));
+    }
+}
+
+TEST(ArrayBench, BENCHMARK_BasicMass_IntColumn) {
+    const int N = 1000000;
+    auto start = std::chrono::high_resolution_clock::now();
+    BasicMass<int> m;
+    for (int i = 0; i < N; ++i) m.push_back(i);
+    for (int i = 0; i < 200; ++i) m.insert_at(N / 2, i);
+    std::stringstream ss;
+    m.serialize(ss);
+    BasicMass<int> restored;
+    restored.deserialize(ss);
+    auto end = std::chrono::high_resolution_clock::now();
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    std::cout << "\nBasicMass<int> push x" << N << " + insert_at x200 + serialize/deserialize: " << ms << " ms\n";
+    EXPECT_EQ(restored.get_size(), N + 200);
+}
+
+TEST(ArrayBench, BENCHMARK_BasicMass_HeapVsMonotonicArena) {
+    const int N = 1000000;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < 20; ++round) {
+        BasicMass<int> m;
+        for (int i = 0; i < N / 20; ++i) m.push_back(i);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < 20; ++round) {
+        std::pmr::monotonic_buffer_resource arena;
+        BasicMass<int, std::pmr::polymorphic_allocator<int>> m(&arena);
+        m.set_growth_factor(1.5);
+        for (int i = 0; i < N / 20; ++i) m.push_back(i);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto heap_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto arena_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count();
+    std::cout << "\nshort-lived arrays x20: heap " << heap_ms << " ms, monotonic arena " << arena_ms << " ms\n";
+}
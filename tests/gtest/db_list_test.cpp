@@ -1,6 +1,18 @@
 #include "gtest/gtest.h"
 #include "../sd/db_list/db_list.hpp"
+#include "../sd/db_list/lru_cache.hpp"
+#include "../sd/db_list/compact_db_list.hpp"
+#include "../sd/db_list/concurrent_db_list.hpp"
+#include <mutex>
 #include <chrono>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 class DBListTest : public ::testing::Test {
 protected:
@@ -316,6 +328,600 @@ TEST_F(DBListTest, EdgeCases) {
     EXPECT_TRUE(list->is_empty());
 }
 
+// Проверка связей в обе стороны и совпадения с ожидаемой последовательностью
+static void expect_links(const DoublyList& l, const std::vector<std::string>& want) {
+    ASSERT_EQ(l.get_size(), static_cast<int>(want.size()));
+    auto cur = l.get_at(0);
+    decltype(cur) prev = nullptr;
+    for (size_t i = 0; i < want.size(); ++i) {
+        ASSERT_NE(cur, nullptr);
+        EXPECT_EQ(cur->data, want[i]);
+        EXPECT_EQ(cur->prev, prev);
+        prev = cur;
+        cur = cur->next;
+    }
+    EXPECT_EQ(cur, nullptr);
+    if (!want.empty()) {
+        // tail должен указывать на последний узел: del_tail его и удалит
+        std::stringstream ss;
+        std::streambuf* old = std::cout.rdbuf(ss.rdbuf());
+        l.print_backward();
+        std::cout.rdbuf(old);
+        EXPECT_EQ(ss.str().substr(0, want.back().size()), want.back());
+    }
+}
+
+TEST_F(DBListTest, SortRelinksNodesStably) {
+    list->sort();
+    EXPECT_TRUE(list->is_empty());
+
+    std::vector<std::string> vals = {"d", "b", "a", "b", "c", "a", "e", "b"};
+    for (const auto& v : vals) list->push_back(v);
+    // Адреса узлов "b" в исходном порядке
+    std::vector<const void*> bs;
+    for (int i = 0; i < list->get_size(); ++i)
+        if (list->get_at(i)->data == "b") bs.push_back(list->get_at(i));
+
+    list->sort();
+    std::vector<std::string> want = vals;
+    std::stable_sort(want.begin(), want.end());
+    expect_links(*list, want);
+    EXPECT_EQ(static_cast<const void*>(list->get_at(2)), bs[0]);
+    EXPECT_EQ(static_cast<const void*>(list->get_at(3)), bs[1]);
+    EXPECT_EQ(static_cast<const void*>(list->get_at(4)), bs[2]);
+
+    list->push_back("0");
+    list->push_front("z");
+    list->sort();
+    EXPECT_EQ(list->get_at(0)->data, "0");
+    EXPECT_EQ(list->get_at(list->get_size() - 1)->data, "z");
+    list->del_tail();
+    EXPECT_EQ(list->get_at(list->get_size() - 1)->data, "e");
+}
+
+TEST_F(DBListTest, ParallelSortMatchesSequential) {
+    std::mt19937 rng(3);
+    std::vector<std::string> vals;
+    for (int i = 0; i < 30000; ++i) vals.push_back(std::to_string(rng() % 5000));
+    DoublyList seq;
+    for (const auto& v : vals) {
+        list->push_back(v);
+        seq.push_back(v);
+    }
+    list->parallel_sort(4);
+    seq.sort();
+    std::sort(vals.begin(), vals.end());
+    expect_links(*list, vals);
+    expect_links(seq, vals);
+
+    DoublyList small;
+    small.push_back("b");
+    small.push_back("a");
+    small.parallel_sort(8); // слишком мало узлов — последовательный путь
+    expect_links(small, {"a", "b"});
+}
+
+TEST_F(DBListTest, SpliceConcatSplit) {
+    DoublyList other;
+    for (const char* v : {"a", "b", "c"}) list->push_back(v);
+    for (const char* v : {"x", "y"}) other.push_back(v);
+    auto y = other.get_at(1);
+    list->splice(list->find("b"), other);
+    EXPECT_TRUE(other.is_empty());
+    expect_links(*list, {"a", "x", "y", "b", "c"});
+    EXPECT_EQ(list->get_at(2), y);
+
+    other.push_back("z");
+    list->concat(other);
+    other.push_back("0");
+    list->splice(list->get_at(0), other);
+    expect_links(*list, {"0", "a", "x", "y", "b", "c", "z"});
+
+    // Диапазон в другой список и внутри одного списка
+    list->splice_range(nullptr, *list, list->find("x"), list->find("y"));
+    expect_links(*list, {"0", "a", "b", "c", "z", "x", "y"});
+    other.splice_range(nullptr, *list, list->get_at(0), list->get_at(1));
+    expect_links(other, {"0", "a"});
+    expect_links(*list, {"b", "c", "z", "x", "y"});
+
+    list->split_at(3, other);
+    expect_links(*list, {"b", "c", "z"});
+    expect_links(other, {"0", "a", "x", "y"});
+    list->split_at(7, other);
+    expect_links(*list, {"b", "c", "z"});
+    other.split_at(0, *list);
+    EXPECT_TRUE(other.is_empty());
+    expect_links(*list, {"b", "c", "z", "0", "a", "x", "y"});
+    list->del_tail();
+    list->del_head();
+    expect_links(*list, {"c", "z", "0", "a", "x"});
+}
+
+TEST_F(DBListTest, BidirectionalIterators) {
+    EXPECT_TRUE(list->begin() == list->end());
+    for (const char* v : {"a", "b", "c", "d"}) list->push_back(v);
+    for (std::string& s : *list) s += "1";
+    std::vector<std::string> back(std::make_reverse_iterator(list->end()),
+                                  std::make_reverse_iterator(list->begin()));
+    EXPECT_EQ(back, (std::vector<std::string>{"d1", "c1", "b1", "a1"}));
+
+    DoublyList::iterator it = list->end();
+    --it;
+    EXPECT_EQ(*it, "d1");
+    it--;
+    EXPECT_EQ(it->front(), 'c');
+    DoublyList::const_iterator cit = it;
+    EXPECT_EQ(*cit, "c1");
+    EXPECT_TRUE(cit != list->cbegin());
+
+    std::reverse(list->begin(), list->end());
+    expect_links(*list, {"d1", "c1", "b1", "a1"});
+    const DoublyList& cl = *list;
+    EXPECT_EQ(std::accumulate(cl.begin(), cl.end(), std::string()), "d1c1b1a1");
+    EXPECT_EQ(std::count_if(cl.begin(), cl.end(),
+                            [](const std::string& s) { return s < "c"; }), 2);
+}
+
+TEST_F(DBListTest, CursorEditing) {
+    auto b = list->push_back("b");
+    auto a = list->push_front("a");
+    auto c = list->push_back("c");
+    EXPECT_EQ(*a, "a");
+
+    auto ab = list->insert_after(a, "ab");
+    list->insert_before(c, "bc");
+    auto tail = list->insert_after(c, "d");
+    expect_links(*list, {"a", "ab", "b", "bc", "c", "d"});
+    list->insert_before(list->end(), "e");
+    list->insert_before(a, "0");
+    expect_links(*list, {"0", "a", "ab", "b", "bc", "c", "d", "e"});
+
+    // Курсоры переживают чужие правки
+    EXPECT_EQ(list->erase(ab), b);
+    auto next = list->erase(list->cursor_at(0));
+    EXPECT_EQ(next, a);
+    EXPECT_EQ(list->erase(list->cursor_of("e")), list->end());
+    EXPECT_EQ(*b, "b");
+    EXPECT_EQ(*tail, "d");
+    expect_links(*list, {"a", "b", "bc", "c", "d"});
+
+    // Движение курсора и правка в текущей позиции
+    auto cur = b;
+    ++cur;
+    cur = list->erase(cur);
+    EXPECT_EQ(*cur, "c");
+    --cur;
+    EXPECT_EQ(cur, b);
+    list->erase(tail);
+    list->erase(list->cursor_of("c"));
+    expect_links(*list, {"a", "b"});
+    EXPECT_EQ(list->erase(list->end()), list->end());
+    EXPECT_EQ(list->cursor_of("zz"), list->end());
+    list->erase(a);
+    list->erase(b);
+    EXPECT_TRUE(list->is_empty());
+    auto only = list->insert_after(list->end(), "x");
+    expect_links(*list, {"x"});
+    EXPECT_EQ(list->begin(), only);
+}
+
+TEST_F(DBListTest, CompactKeepsLinks) {
+    EXPECT_EQ(list->compact(), 0u);
+    std::vector<std::string> want;
+    for (int i = 0; i < 300; ++i) list->push_back(std::to_string(i));
+    for (int i = 0; i < 300; i += 2) list->del(std::to_string(i));
+    for (int i = 1; i < 300; i += 2) want.push_back(std::to_string(i));
+    EXPECT_GT(list->compact(), 0u);
+    expect_links(*list, want);
+    EXPECT_EQ(list->get_at(1), list->get_at(0) + 1);
+
+    auto c = list->cursor_of("151");
+    list->insert_before(c, "x");
+    list->erase(c);
+    list->del_head();
+    list->del_tail();
+    DoublyList other;
+    list->split_at(10, other);
+    other.compact();
+    list->concat(other);
+    list->sort();
+    EXPECT_EQ(list->get_size(), 148);
+    EXPECT_EQ(list->get_at(0)->data, "101");
+    list->compact();
+    EXPECT_EQ(list->compact(), 0u); // уже дефрагментирован
+}
+
+// Блок compact() делится между списками через split_at и splice;
+// списки освобождают свои узлы параллельно
+TEST_F(DBListTest, CompactSlabSharedAcrossLists) {
+    for (int round = 0; round < 20; ++round) {
+        DoublyList a, b, c;
+        for (int i = 0; i < 3000; ++i) a.push_back(std::to_string(i));
+        a.compact();
+        a.split_at(1000, b);
+        b.split_at(1000, c);
+        a.splice(a.get_at(500), c);
+        EXPECT_EQ(a.get_size(), 2000);
+        std::thread t1([&a] {
+            while (!a.is_empty()) a.del_head();
+        });
+        std::thread t2([&b] {
+            while (!b.is_empty()) b.del_tail();
+        });
+        t1.join();
+        t2.join();
+        b.push_back("after");
+        b.compact();
+    }
+}
+
+// ===== COMPACT DOUBLY LIST =====
+static std::string dump(const CompactDoublyList& l) {
+    std::stringstream ss;
+    l.serialize(ss);
+    return ss.str();
+}
+
+static std::string dump(const DoublyList& l) {
+    std::stringstream ss;
+    l.serialize(ss);
+    return ss.str();
+}
+
+TEST_F(DBListTest, PositionIndexInsertAndDeleteAt) {
+    list->enable_position_index();
+    EXPECT_TRUE(list->is_position_indexed());
+    EXPECT_EQ(list->insert_at(1, "x"), list->end()); // вне диапазона
+    list->insert_at(0, "b");
+    list->insert_at(0, "a");
+    list->insert_at(2, "d");
+    list->insert_at(2, "c");
+    expect_links(*list, {"a", "b", "c", "d"});
+    list->del_at(1);
+    list->del_at(5);
+    expect_links(*list, {"a", "c", "d"});
+    list->disable_position_index();
+    EXPECT_EQ(list->position_index_memory_usage(), 0u);
+    list->insert_at(3, "e");
+    list->del_at(0);
+    expect_links(*list, {"c", "d", "e"});
+}
+
+// Случайная смесь правок: список с индексом ведёт себя как без него
+TEST_F(DBListTest, PositionIndexMatchesPlainList) {
+    DoublyList plain;
+    list->enable_position_index();
+    std::mt19937 rng(7);
+    for (int step = 0; step < 3000; ++step) {
+        int size = plain.get_size();
+        std::string val = std::to_string(step);
+        std::string key = size ? plain.get_at(static_cast<int>(rng() % size))->data : "none";
+        int index = static_cast<int>(rng() % (size + 1));
+        switch (rng() % 16) {
+        case 0: plain.push_back(val); list->push_back(val); break;
+        case 1: plain.push_front(val); list->push_front(val); break;
+        case 2: plain.insert_at(index, val); list->insert_at(index, val); break;
+        case 3: plain.del_at(index); list->del_at(index); break;
+        case 4: plain.del_head(); list->del_head(); break;
+        case 5: plain.del_tail(); list->del_tail(); break;
+        case 6: plain.del_after(key); list->del_after(key); break;
+        case 7: plain.del_before(key); list->del_before(key); break;
+        case 8:
+            plain.erase(plain.cursor_at(index));
+            list->erase(list->cursor_at(index));
+            break;
+        case 9:
+            if (step % 200 == 0) { plain.sort(); list->sort(); }
+            break;
+        case 10:
+            plain.insert_before(plain.cursor_at(index), val);
+            list->insert_before(list->cursor_at(index), val);
+            break;
+        case 11:
+            plain.insert_after(plain.cursor_at(index), val);
+            list->insert_after(list->cursor_at(index), val);
+            break;
+        default: {
+            std::stringstream out;
+            std::streambuf* old = std::cout.rdbuf(out.rdbuf());
+            if (step % 3) { plain.insert_after(key, val); list->insert_after(key, val); }
+            else { plain.insert_before(key, val); list->insert_before(key, val); }
+            if (step % 7 == 0) { plain.del(key); list->del(key); }
+            std::cout.rdbuf(old);
+        }
+        }
+        ASSERT_EQ(list->get_size(), plain.get_size()) << "step " << step;
+        int probe = static_cast<int>(rng() % (plain.get_size() + 1));
+        auto a = plain.get_at(probe);
+        auto b = list->get_at(probe);
+        ASSERT_EQ(a == nullptr, b == nullptr);
+        if (a) {
+            ASSERT_EQ(a->data, b->data) << "step " << step;
+        }
+    }
+    EXPECT_EQ(dump(*list), dump(plain));
+    EXPECT_GT(list->position_index_memory_usage(), 0u);
+    std::stringstream ss(dump(plain));
+    list->deserialize(ss);
+    list->compact();
+    for (int i = 0; i < plain.get_size(); ++i)
+        ASSERT_EQ(list->get_at(i)->data, plain.get_at(i)->data);
+}
+
+// После правок по курсору и splice константный get_at ничего не
+// перестраивает: чтение из нескольких потоков безопасно
+TEST_F(DBListTest, PositionIndexConstReadsFromManyThreads) {
+    list->enable_position_index();
+    for (int i = 0; i < 2000; ++i) list->push_back(std::to_string(i));
+    list->erase(list->insert_after(list->cursor_at(10), "tmp"));
+    list->insert_before(list->cursor_at(0), "first");
+    DoublyList tail_part;
+    tail_part.push_back("last");
+    list->concat(tail_part);
+    const DoublyList &view = *list;
+    std::vector<std::thread> readers;
+    std::vector<int> mismatches(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&view, &mismatches, t] {
+            for (int i = 0; i < 2000; ++i) {
+                if (view.get_at(i + 1)->data != std::to_string(i)) ++mismatches[t];
+            }
+        });
+    }
+    for (std::thread &t : readers) t.join();
+    for (int m : mismatches) EXPECT_EQ(m, 0);
+    EXPECT_EQ(view.get_at(0)->data, "first");
+    EXPECT_EQ(view.get_at(2001)->data, "last");
+    EXPECT_EQ(view.get_size(), 2002);
+}
+
+TEST(CompactDoublyListTest, MatchesDoublyList) {
+    DoublyList ref;
+    CompactDoublyList lst;
+    EXPECT_TRUE(lst.is_empty());
+    EXPECT_EQ(lst.get_at(0), nullptr);
+    std::mt19937 rng(11);
+    auto key = [&] { return std::to_string(rng() % 20); };
+    std::stringstream sink;
+    std::streambuf* old = std::cout.rdbuf(sink.rdbuf());
+    for (int step = 0; step < 3000; ++step) {
+        std::string a = key(), b = key();
+        switch (rng() % 9) {
+        case 0: ref.push_back(a); lst.push_back(a); break;
+        case 1: ref.push_front(a); lst.push_front(a); break;
+        case 2: ref.insert_after(a, b); lst.insert_after(a, b); break;
+        case 3: ref.insert_before(a, b); lst.insert_before(a, b); break;
+        case 4: ref.del(a); lst.del(a); break;
+        case 5: ref.del_after(a); lst.del_after(a); break;
+        case 6: ref.del_before(a); lst.del_before(a); break;
+        case 7: ref.del_head(); lst.del_head(); break;
+        default: ref.del_tail(); lst.del_tail(); break;
+        }
+        ASSERT_EQ(dump(ref), dump(lst)) << "step " << step;
+    }
+    ref.print_backward();
+    lst.print_backward();
+    std::cout.rdbuf(old);
+    EXPECT_EQ(lst.get_size(), ref.get_size());
+    for (int i = 0; i < ref.get_size(); ++i)
+        EXPECT_EQ(*lst.get_at(i), ref.get_at(i)->data);
+    EXPECT_EQ(lst.find("nope"), nullptr);
+}
+
+TEST(CompactDoublyListTest, FreeListReuseAndShrink) {
+    CompactDoublyList lst;
+    for (int i = 0; i < 100; ++i) lst.push_back(std::to_string(i));
+    size_t full = lst.memory_usage();
+    for (int i = 0; i < 100; i += 2) lst.del(std::to_string(i));
+    for (int i = 0; i < 50; ++i) lst.push_front("n" + std::to_string(i));
+    EXPECT_EQ(lst.memory_usage(), full); // ячейки переиспользованы
+    EXPECT_EQ(*lst.get_at(0), "n49");
+    EXPECT_EQ(*lst.get_at(50), "1");
+    EXPECT_EQ(*lst.get_at(99), "99");
+
+    for (int i = 0; i < 60; ++i) lst.del_tail();
+    std::string before = dump(lst);
+    lst.shrink_to_fit();
+    EXPECT_LT(lst.memory_usage(), full);
+    EXPECT_EQ(lst.get_size(), 40);
+    EXPECT_EQ(dump(lst), before); // порядок не нарушен
+    EXPECT_EQ(*lst.get_at(39), "n10");
+    lst.insert_after("n10", "end");
+    lst.insert_before("n49", "start");
+    EXPECT_EQ(*lst.get_at(0), "start");
+    EXPECT_EQ(*lst.get_at(41), "end");
+
+    // Вставка значения, лежащего в самом списке, при росте вектора
+    lst.shrink_to_fit();
+    lst.push_back(*lst.get_at(0));
+    EXPECT_EQ(*lst.get_at(42), "start");
+
+    std::stringstream ss("2\nx\ny\n");
+    lst.deserialize(ss);
+    EXPECT_EQ(dump(lst), "2\nx\ny\n");
+    lst.del_before("y");
+    lst.del_after("y");
+    EXPECT_EQ(dump(lst), "1\ny\n");
+}
+
+// ===== CONCURRENT DOUBLY LIST =====
+static std::vector<std::string> items_of(const ConcurrentDoublyList& l) {
+    std::stringstream ss;
+    l.serialize(ss);
+    int n = 0;
+    ss >> n;
+    ss.ignore();
+    std::vector<std::string> out(n);
+    for (auto& s : out) std::getline(ss, s);
+    return out;
+}
+
+TEST(ConcurrentDoublyListTest, SingleThreadMatchesDoublyList) {
+    DoublyList ref;
+    ConcurrentDoublyList lst;
+    std::mt19937 rng(17);
+    std::stringstream sink;
+    std::streambuf* old = std::cout.rdbuf(sink.rdbuf());
+    for (int step = 0; step < 3000; ++step) {
+        std::string a = std::to_string(rng() % 15), b = std::to_string(rng() % 15);
+        switch (rng() % 9) {
+        case 0: ref.push_back(a); lst.push_back(a); break;
+        case 1: ref.push_front(a); lst.push_front(a); break;
+        case 2: ref.insert_after(a, b); lst.insert_after(a, b); break;
+        case 3: ref.insert_before(a, b); lst.insert_before(a, b); break;
+        case 4: ref.del(a); lst.del(a); break;
+        case 5: ref.del_after(a); lst.del_after(a); break;
+        case 6: ref.del_before(a); lst.del_before(a); break;
+        case 7: ref.del_head(); lst.del_head(); break;
+        default: ref.del_tail(); lst.del_tail(); break;
+        }
+        std::stringstream x;
+        lst.serialize(x);
+        ASSERT_EQ(dump(ref), x.str()) << "step " << step;
+    }
+    std::cout.rdbuf(old);
+    EXPECT_EQ(lst.get_size(), ref.get_size());
+    std::string v;
+    if (ref.get_size() > 0) {
+        ASSERT_TRUE(lst.get_at(ref.get_size() - 1, v));
+        EXPECT_EQ(v, ref.get_at(ref.get_size() - 1)->data);
+    }
+    EXPECT_FALSE(lst.get_at(ref.get_size(), v));
+    EXPECT_EQ(lst.contains("0"), ref.find("0") != nullptr);
+}
+
+TEST(ConcurrentDoublyListTest, ConcurrentPushesKeepEveryElement) {
+    ConcurrentDoublyList lst;
+    const int T = 4, N = 2000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < T; ++t) {
+        workers.emplace_back([&lst, t] {
+            for (int i = 0; i < N; ++i) {
+                std::string v = std::to_string(t) + ":" + std::to_string(i);
+                if (i % 2) lst.push_back(v); else lst.push_front(v);
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    auto items = items_of(lst);
+    ASSERT_EQ(lst.get_size(), T * N);
+    std::sort(items.begin(), items.end());
+    EXPECT_EQ(std::unique(items.begin(), items.end()), items.end());
+    EXPECT_EQ(items.size(), static_cast<size_t>(T * N));
+}
+
+TEST(ConcurrentDoublyListTest, StressMixedOperations) {
+    ConcurrentDoublyList lst;
+    const int T = 4, OPS = 3000;
+    for (int t = 0; t < T; ++t)
+        for (int k = 0; k < 8; ++k) lst.push_back(std::to_string(t) + "_" + std::to_string(k));
+    std::vector<std::thread> workers;
+    for (int t = 0; t < T; ++t) {
+        workers.emplace_back([&lst, t] {
+            std::mt19937 rng(100 + t);
+            std::string out;
+            for (int i = 0; i < OPS; ++i) {
+                // Ключи пересекаются между потоками, чтобы правки сталкивались
+                std::string a = std::to_string(rng() % T) + "_" + std::to_string(rng() % 8);
+                std::string b = std::to_string(rng() % T) + "_" + std::to_string(rng() % 8);
+                switch (rng() % 10) {
+                case 0: lst.push_back(a); break;
+                case 1: lst.push_front(a); break;
+                case 2: lst.insert_after(a, b); break;
+                case 3: lst.insert_before(a, b); break;
+                case 4: lst.del(a); break;
+                case 5: lst.del_after(a); break;
+                case 6: lst.del_before(a); break;
+                case 7: lst.pop_front(out); break;
+                case 8: lst.pop_back(out); break;
+                default: lst.contains(a); lst.get_at(static_cast<int>(rng() % 16), out);
+                }
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    // Связи next и prev согласованы: снятие с хвоста даёт обратный порядок
+    auto forward = items_of(lst);
+    ASSERT_EQ(static_cast<int>(forward.size()), lst.get_size());
+    std::vector<std::string> backward;
+    std::string v;
+    while (lst.pop_back(v)) backward.push_back(v);
+    std::reverse(backward.begin(), backward.end());
+    EXPECT_EQ(forward, backward);
+    EXPECT_TRUE(lst.is_empty());
+}
+
+// ===== LRU CACHE =====
+TEST(LRUCacheTest, EvictsLeastRecentlyUsed) {
+    LRUCache<std::string, int> cache(3);
+    EXPECT_EQ(cache.get("a"), nullptr);
+    cache.put("a", 1);
+    cache.put("b", 2);
+    cache.put("c", 3);
+    ASSERT_NE(cache.get("a"), nullptr); // a становится самой свежей
+    cache.put("d", 4);                  // вытесняется b
+    EXPECT_FALSE(cache.contains("b"));
+    EXPECT_TRUE(cache.contains("a"));
+    EXPECT_EQ(cache.get_size(), 3u);
+
+    cache.put("c", 30); // замена без вытеснения, c — свежая
+    cache.put("e", 5);  // вытесняется a
+    EXPECT_FALSE(cache.contains("a"));
+    EXPECT_EQ(*cache.get("c"), 30);
+    *cache.get("e") += 1;
+    EXPECT_EQ(*cache.get("e"), 6);
+
+    EXPECT_EQ(cache.hits(), 4u);
+    EXPECT_EQ(cache.misses(), 1u);
+    EXPECT_EQ(cache.evictions(), 2u);
+    cache.reset_stats();
+    EXPECT_EQ(cache.hits() + cache.misses() + cache.evictions(), 0u);
+}
+
+TEST(LRUCacheTest, EraseClearAndLimits) {
+    LRUCache<int, std::string> cache(0); // без лимита числа записей
+    for (int i = 0; i < 100; ++i) cache.put(i, std::to_string(i));
+    EXPECT_EQ(cache.get_size(), 100u);
+    EXPECT_TRUE(cache.erase(50));
+    EXPECT_FALSE(cache.erase(50));
+    EXPECT_EQ(cache.get(50), nullptr);
+
+    cache.set_limits(10, 0); // остаются 10 самых свежих: 90..99
+    EXPECT_EQ(cache.get_size(), 10u);
+    EXPECT_EQ(cache.evictions(), 89u);
+    EXPECT_TRUE(cache.contains(90));
+    EXPECT_FALSE(cache.contains(89));
+
+    cache.clear();
+    EXPECT_EQ(cache.get_size(), 0u);
+    EXPECT_EQ(cache.get_bytes(), 0u);
+    cache.put(1, "x");
+    cache.put(2, "y");
+    cache.erase(2);
+    cache.erase(1);
+    cache.put(3, "z");
+    EXPECT_EQ(*cache.get(3), "z");
+}
+
+TEST(LRUCacheTest, ByteLimit) {
+    LRUCache<std::string, std::string> cache(0, 20);
+    EXPECT_TRUE(cache.put("k1", std::string(8, 'a'))); // 10 байт
+    EXPECT_TRUE(cache.put("k2", std::string(8, 'b'))); // 20 байт
+    EXPECT_EQ(cache.get_bytes(), 20u);
+    cache.get("k1");
+    EXPECT_TRUE(cache.put("k3", "c")); // 3 байта -> вытесняется k2
+    EXPECT_FALSE(cache.contains("k2"));
+    EXPECT_EQ(cache.get_bytes(), 13u);
+
+    cache.put("k1", ""); // вес уменьшается при замене
+    EXPECT_EQ(cache.get_bytes(), 5u);
+    EXPECT_FALSE(cache.put("k3", std::string(30, 'x'))); // тяжелее лимита
+    EXPECT_FALSE(cache.contains("k3"));
+    EXPECT_EQ(cache.get_bytes(), 2u);
+    EXPECT_EQ(cache.get_max_bytes(), 20u);
+}
+
 // ===== BENCHMARKS =====
 TEST(DBListBench, BENCHMARK_DBList_PushBack) {
     auto start = std::chrono::high_resolution_clock::now();
@@ -354,4 +960,211 @@ TEST(DBListBench, BENCHMARK_Find) {
     auto end = std::chrono::high_resolution_clock::now();
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
     std::cout << "\nfind x50000: " << ms << " ms\n";
-}
\ No newline at end of file
+}
+TEST(DBListBench, BENCHMARK_DBList_Sort) {
+    const int N = 1000000;
+    std::mt19937 rng(1);
+    DoublyList a, b;
+    for (int i = 0; i < N; ++i) {
+        std::string v = "elem_" + std::to_string(rng());
+        a.push_back(v);
+        b.push_back(v);
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    a.sort();
+    auto mid = std::chrono::high_resolution_clock::now();
+    b.parallel_sort();
+    auto end = std::chrono::high_resolution_clock::now();
+    auto seq_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto par_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count();
+    std::cout << "\nsort 1M: sequential " << seq_ms << " ms, parallel (" << std::thread::hardware_concurrency()
+              << " threads) " << par_ms << " ms\n";
+    EXPECT_EQ(a.get_at(N / 2)->data, b.get_at(N / 2)->data);
+}
+
+TEST(DBListBench, BENCHMARK_DBList_IndexLoopVsIterator) {
+    const int N = 20000;
+    DoublyList l;
+    for (int i = 0; i < N; ++i) l.push_back("elem_" + std::to_string(i));
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t by_index = 0;
+    for (int i = 0; i < N; ++i) by_index += l.get_at(i)->data.size();
+    auto mid = std::chrono::high_resolution_clock::now();
+    size_t by_iter = std::accumulate(l.begin(), l.end(), size_t(0),
+        [](size_t acc, const std::string& s) { return acc + s.size(); });
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(by_index, by_iter);
+    auto index_us = std::chrono::duration_cast<std::chrono::microseconds>(mid - start).count();
+    auto iter_us = std::chrono::duration_cast<std::chrono::microseconds>(end - mid).count();
+    std::cout << "\ntraverse 20k: get_at loop " << index_us << " us, iterator " << iter_us << " us\n";
+}
+
+TEST(DBListBench, BENCHMARK_DBList_CursorVsKeyEdits) {
+    const int N = 20000, EDITS = 5000;
+    DoublyList by_key, by_cursor;
+    for (int i = 0; i < N; ++i) {
+        by_key.push_back("line_" + std::to_string(i));
+        by_cursor.push_back("line_" + std::to_string(i));
+    }
+    // Правки «редактора» в одной позиции в конце документа
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < EDITS; ++i) {
+        by_key.insert_before("line_19000", "typed");
+        by_key.del_before("line_19000");
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    auto pos = by_cursor.cursor_of("line_19000");
+    for (int i = 0; i < EDITS; ++i) {
+        by_cursor.erase(by_cursor.insert_before(pos, "typed"));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto key_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto cursor_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count();
+    std::cout << "\n5000 edits at one position: by key " << key_ms << " ms, by cursor "
+              << cursor_ms << " ms\n";
+    EXPECT_EQ(by_key.get_size(), by_cursor.get_size());
+}
+
+TEST(DBListBench, BENCHMARK_DBList_PositionIndex) {
+    const int N = 100000, OPS = 2000;
+    DoublyList plain, indexed;
+    for (int i = 0; i < N; ++i) {
+        plain.push_back(std::to_string(i));
+        indexed.push_back(std::to_string(i));
+    }
+    indexed.enable_position_index();
+    // Доступ и правки ближе к концу списка — худший случай для прохода от головы
+    auto run = [&](DoublyList& l) {
+        std::mt19937 rng(1);
+        size_t sum = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < OPS; ++i) {
+            int pos = N / 2 + static_cast<int>(rng() % (N / 2));
+            sum += l.get_at(pos)->data.size();
+            l.insert_at(pos, "x");
+            l.del_at(pos + 1);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        EXPECT_GT(sum, 0u);
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    };
+    auto plain_us = run(plain);
+    auto indexed_us = run(indexed);
+    EXPECT_EQ(dump(plain), dump(indexed));
+    std::cout << "\n" << OPS << " get_at + insert_at + del_at on 100k: plain " << plain_us
+              << " us, skip index " << indexed_us << " us, index "
+              << indexed.position_index_memory_usage() / 1024 << " KiB\n";
+
+    // Правки по курсору вперемешку с доступом по позиции: индекс
+    // правится на месте и не перестраивается
+    auto mixed = [&](DoublyList& l) {
+        std::mt19937 rng(2);
+        size_t sum = 0;
+        auto cur = l.cursor_at(N / 2);
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < OPS; ++i) {
+            cur = l.insert_after(cur, "y");
+            cur = l.erase(cur);
+            sum += l.get_at(N / 2 + static_cast<int>(rng() % (N / 2)))->data.size();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        EXPECT_GT(sum, 0u);
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    };
+    auto plain_mixed_us = mixed(plain);
+    auto indexed_mixed_us = mixed(indexed);
+    EXPECT_EQ(dump(plain), dump(indexed));
+    std::cout << OPS << " cursor insert + erase + get_at on 100k: plain " << plain_mixed_us
+              << " us, skip index " << indexed_mixed_us << " us\n";
+}
+
+TEST(DBListBench, BENCHMARK_LRUCache_Zipf) {
+    const int KEYS = 100000, OPS = 1000000;
+    // Распределение Ципфа с s = 1: вес ключа k пропорционален 1 / k
+    std::vector<double> weights(KEYS);
+    for (int k = 0; k < KEYS; ++k) weights[k] = 1.0 / (k + 1);
+    std::discrete_distribution<int> zipf(weights.begin(), weights.end());
+    std::mt19937 rng(42);
+    std::vector<std::string> keys(KEYS);
+    for (int k = 0; k < KEYS; ++k) keys[k] = "user:" + std::to_string(k);
+    std::vector<int> trace(OPS);
+    for (int& t : trace) t = zipf(rng);
+
+    LRUCache<std::string, std::string> cache(KEYS / 10);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int t : trace) {
+        if (!cache.get(keys[t])) cache.put(keys[t], keys[t]);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    std::cout << "\nLRU Zipf 1M ops (10% capacity): " << ms << " ms, hit rate "
+              << 100.0 * cache.hits() / OPS << "%, evictions " << cache.evictions() << "\n";
+    EXPECT_EQ(cache.hits() + cache.misses(), static_cast<uint64_t>(OPS));
+}
+
+TEST(DBListBench, BENCHMARK_CompactDoublyList_MemoryAndTraversal) {
+    const int N = 1000000;
+    DoublyList ref;
+    CompactDoublyList lst;
+    for (int i = 0; i < N; ++i) {
+        std::string v = std::to_string(i);
+        ref.push_back(v);
+        lst.push_back(v);
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < 5; ++r) EXPECT_EQ(ref.find("missing"), nullptr);
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < 5; ++r) EXPECT_EQ(lst.find("missing"), nullptr);
+    auto end = std::chrono::high_resolution_clock::now();
+    lst.shrink_to_fit();
+    // Узел DoublyList: строка, два указателя и заголовок malloc (~16 байт)
+    size_t ref_bytes = static_cast<size_t>(N) * (sizeof(std::string) + 2 * sizeof(void*) + 16);
+    std::cout << "\nfull scan x5 (1M): DoublyList "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count()
+              << " ms, CompactDoublyList "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count()
+              << " ms\nnode memory: DoublyList ~" << ref_bytes / 1024 << " KiB, compact "
+              << lst.memory_usage() / 1024 << " KiB\n";
+    EXPECT_LT(lst.memory_usage(), ref_bytes);
+}
+
+TEST(DBListBench, BENCHMARK_ConcurrentDoublyList_Threads) {
+    const int BASE = 1000, OPS = 4000;
+    for (int threads : {1, 2, 4, 8}) {
+        ConcurrentDoublyList fine;
+        DoublyList coarse;
+        std::mutex coarse_lock;
+        for (int i = 0; i < BASE; ++i) {
+            fine.push_back("k" + std::to_string(i));
+            coarse.push_back("k" + std::to_string(i));
+        }
+        // Каждый поток правит возле своего ключа в своей части списка
+        auto run = [&](auto&& op) {
+            std::vector<std::thread> workers;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int t = 0; t < threads; ++t) {
+                workers.emplace_back([&, t] {
+                    std::string anchor = "k" + std::to_string((t + 1) * BASE / (threads + 1));
+                    for (int i = 0; i < OPS / threads; ++i) op(anchor);
+                });
+            }
+            for (auto& w : workers) w.join();
+            auto end = std::chrono::high_resolution_clock::now();
+            return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        };
+        auto fine_us = run([&](const std::string& a) {
+            fine.insert_after(a, "x");
+            fine.del_after(a);
+        });
+        auto coarse_us = run([&](const std::string& a) {
+            std::lock_guard<std::mutex> g(coarse_lock);
+            coarse.insert_after(a, "x");
+            coarse.del_after(a);
+        });
+        std::cout << "\n" << threads << " threads, " << OPS << " edit pairs: per-node locks "
+                  << OPS * 1000000LL / (fine_us + 1) << " ops/s, global mutex "
+                  << OPS * 1000000LL / (coarse_us + 1) << " ops/s";
+        EXPECT_EQ(fine.get_size(), BASE);
+    }
+    std::cout << "\n";
+}
@@ -1,8 +1,14 @@
 #include "gtest/gtest.h"
 #include "../sd/list/list.hpp"
+#include "../sd/list/unrolled_list.hpp"
 #include <sstream>
 #include <string>
 #include <chrono>
+#include <random>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <thread>
 
 std::string capturePrint(const List& lst) {
     std::stringstream ss;
@@ -206,6 +212,520 @@ TEST(ListTest, SerializationSpecialChars) {
     EXPECT_EQ(lst2.get_at(2)->data, "");
 }
 
+static std::string dump(const List& lst) {
+    std::stringstream ss;
+    lst.serialize(ss);
+    return ss.str();
+}
+
+// ===== ITERATORS =====
+TEST(ListTest, IteratorsWorkWithAlgorithms) {
+    List lst;
+    EXPECT_TRUE(lst.begin() == lst.end());
+    for (const char* v : {"ab", "c", "def", "gh"}) lst.push_back(v);
+    std::string joined;
+    for (const std::string& s : lst) joined += s;
+    EXPECT_EQ(joined, "abcdefgh");
+
+    auto it = std::find_if(lst.begin(), lst.end(),
+                           [](const std::string& s) { return s.size() == 3; });
+    ASSERT_NE(it, lst.end());
+    EXPECT_EQ(&*it, &lst.get_at(2)->data); // без копирования
+    EXPECT_EQ(std::distance(lst.cbegin(), lst.cend()), 4);
+    size_t total = std::accumulate(lst.begin(), lst.end(), size_t(0),
+        [](size_t acc, const std::string& s) { return acc + s.size(); });
+    EXPECT_EQ(total, 8u);
+    List::iterator post = lst.begin();
+    EXPECT_EQ(*post++, "ab");
+    EXPECT_EQ(post->size(), 1u);
+}
+
+// ===== SELF-ORGANIZING FIND =====
+TEST(ListTest, MoveToFrontAndTranspose) {
+    List lst;
+    for (const char* v : {"a", "b", "c", "d"}) lst.push_back(v);
+    EXPECT_EQ(lst.get_find_mode(), List::FindMode::Plain);
+    lst.find("c");
+    EXPECT_EQ(capturePrint(lst), "a b c d \n");
+
+    lst.set_find_mode(List::FindMode::MoveToFront);
+    auto d = lst.find("d");
+    EXPECT_EQ(capturePrint(lst), "d a b c \n");
+    EXPECT_EQ(lst.get_at(0), d);
+    lst.push_back("e"); // хвост после переноса — "c"
+    EXPECT_EQ(capturePrint(lst), "d a b c e \n");
+    EXPECT_EQ(lst.find("zz"), nullptr);
+    lst.find("d"); // уже в голове
+
+    lst.set_find_mode(List::FindMode::Transpose);
+    lst.find("e");
+    EXPECT_EQ(capturePrint(lst), "d a b e c \n");
+    lst.find("a");
+    EXPECT_EQ(capturePrint(lst), "a d b e c \n");
+    lst.find("a");
+    EXPECT_EQ(capturePrint(lst), "a d b e c \n");
+    lst.push_back("f");
+    EXPECT_EQ(lst.get_at(5)->data, "f");
+
+    // Правки по ключу и константный find порядок не меняют
+    lst.insert_after("e", "x");
+    lst.del_after("x");
+    const List& cl = lst;
+    EXPECT_EQ(cl.find("f"), lst.get_at(5));
+    EXPECT_EQ(capturePrint(lst), "a d b e x f \n");
+}
+
+TEST(ListTest, SelfOrganizingFindKeepsIndex) {
+    std::mt19937 rng(9);
+    for (auto mode : {List::FindMode::MoveToFront, List::FindMode::Transpose}) {
+        List plain, fast;
+        plain.set_find_mode(mode);
+        fast.set_find_mode(mode);
+        fast.enable_index();
+        for (int i = 0; i < 30; ++i) {
+            std::string v = std::to_string(rng() % 12);
+            plain.push_back(v);
+            fast.push_back(v);
+        }
+        std::stringstream sink;
+        std::streambuf* old = std::cout.rdbuf(sink.rdbuf());
+        for (int step = 0; step < 2000; ++step) {
+            std::string a = std::to_string(rng() % 12);
+            switch (rng() % 4) {
+            case 0: plain.find(a); fast.find(a); break;
+            case 1: plain.del_before(a); fast.del_before(a); plain.push_back(a); fast.push_back(a); break;
+            case 2: plain.insert_before(a, a); fast.insert_before(a, a); break;
+            default: plain.del(a); fast.del(a);
+            }
+            ASSERT_EQ(dump(plain), dump(fast)) << "step " << step;
+        }
+        std::cout.rdbuf(old);
+    }
+}
+
+// ===== SORT =====
+TEST(ListTest, SortRelinksNodesAndKeepsTail) {
+    List lst;
+    lst.sort();
+    EXPECT_TRUE(lst.is_empty());
+    for (const char* v : {"pear", "apple", "fig", "apple", "kiwi"}) lst.push_back(v);
+    auto first_apple = lst.get_at(1);
+    auto second_apple = lst.get_at(3);
+    lst.sort();
+    EXPECT_EQ(capturePrint(lst), "apple apple fig kiwi pear \n");
+    EXPECT_EQ(lst.get_at(0), first_apple);
+    EXPECT_EQ(lst.get_at(1), second_apple);
+    lst.push_back("zz"); // хвост после сортировки — "pear"
+    EXPECT_EQ(lst.get_at(4)->data, "pear");
+    EXPECT_EQ(lst.get_at(5)->data, "zz");
+    lst.del_tail();
+    lst.del_tail();
+    EXPECT_EQ(lst.get_at(3)->data, "kiwi");
+    EXPECT_EQ(lst.get_size(), 4);
+}
+
+TEST(ListTest, ParallelSortAndIndex) {
+    std::mt19937 rng(5);
+    List seq, par;
+    par.enable_index();
+    for (int i = 0; i < 20000; ++i) {
+        std::string v = std::to_string(rng() % 3000);
+        seq.push_back(v);
+        par.push_back(v);
+    }
+    seq.sort();
+    par.parallel_sort(3);
+    std::stringstream a, b;
+    seq.serialize(a);
+    par.serialize(b);
+    EXPECT_EQ(a.str(), b.str());
+    // Индекс перестроен: первое вхождение и удаление по ключу
+    std::string k = par.get_at(10000)->data;
+    int first = 10000;
+    while (first > 0 && par.get_at(first - 1)->data == k) --first;
+    EXPECT_EQ(par.find(k), par.get_at(first));
+    par.del_before(k);
+    EXPECT_EQ(par.get_size(), 19999);
+}
+
+// ===== SPLICE =====
+static List& fill(List& l, std::initializer_list<const char*> vals) {
+    for (const char* v : vals) l.push_back(v);
+    return l;
+}
+
+TEST(ListTest, SpliceAndConcatMoveNodes) {
+    List a, b;
+    fill(a, {"1", "2", "3"});
+    fill(b, {"x", "y"});
+    auto x = b.get_at(0);
+    a.splice(a.find("1"), b);
+    EXPECT_TRUE(b.is_empty());
+    EXPECT_EQ(capturePrint(a), "1 x y 2 3 \n");
+    EXPECT_EQ(a.get_at(1), x); // тот же узел, без копирования
+
+    fill(b, {"p"});
+    a.splice(nullptr, b);
+    fill(b, {"q", "r"});
+    a.concat(b);
+    EXPECT_EQ(capturePrint(a), "p 1 x y 2 3 q r \n");
+    a.push_back("s"); // хвост обновлён
+    EXPECT_EQ(a.get_at(8)->data, "s");
+    a.concat(a);
+    b.concat(a);
+    EXPECT_TRUE(a.is_empty());
+    EXPECT_EQ(b.get_size(), 9);
+}
+
+TEST(ListTest, SpliceRangeAndSplit) {
+    List a, b;
+    fill(a, {"a", "b", "c", "d", "e"});
+    fill(b, {"1", "2"});
+    // Перенос b..d в b после "1"
+    b.splice_range(b.find("1"), a, a.find("a"), a.find("d"));
+    EXPECT_EQ(capturePrint(a), "a e \n");
+    EXPECT_EQ(capturePrint(b), "1 b c d 2 \n");
+
+    // Хвост other: перенос с головы по хвост
+    b.splice_range(b.get_at(4), a, nullptr, a.get_at(1));
+    EXPECT_TRUE(a.is_empty());
+    EXPECT_EQ(capturePrint(b), "1 b c d 2 a e \n");
+    a.push_back("new");
+    EXPECT_EQ(capturePrint(a), "new \n");
+
+    List rest;
+    b.split_at(3, rest);
+    EXPECT_EQ(capturePrint(b), "1 b c \n");
+    EXPECT_EQ(capturePrint(rest), "d 2 a e \n");
+    b.push_back("t");
+    rest.split_at(10, a);
+    EXPECT_EQ(rest.get_size(), 4);
+    rest.split_at(0, a);
+    EXPECT_TRUE(rest.is_empty());
+    EXPECT_EQ(capturePrint(a), "new d 2 a e \n");
+    EXPECT_EQ(capturePrint(b), "1 b c t \n");
+}
+
+TEST(ListTest, SpliceKeepsIndexesConsistent) {
+    List a, b;
+    a.enable_index();
+    b.enable_index();
+    fill(a, {"k1", "k2", "k3"});
+    fill(b, {"m1", "m2", "k2"});
+    a.splice_range(a.find("k1"), b, nullptr, b.find("m2"));
+    EXPECT_EQ(b.find("m1"), nullptr);
+    EXPECT_EQ(b.find("k2"), b.get_at(0));
+    EXPECT_EQ(a.find("m2"), a.get_at(2));
+    a.del_before("k2"); // удаляет "m2"
+    EXPECT_EQ(capturePrint(a), "k1 m1 k2 k3 \n");
+    a.concat(b);
+    EXPECT_EQ(b.find("k2"), nullptr);
+    a.del("k2");
+    EXPECT_EQ(a.find("k2"), a.get_at(3));
+}
+
+// ===== COMPACT =====
+TEST(ListTest, CompactMakesNodesContiguous) {
+    List lst;
+    EXPECT_EQ(lst.compact(), 0u);
+    for (int i = 0; i < 2000; ++i) lst.push_back("value_" + std::to_string(i));
+    for (int i = 0; i < 2000; i += 3) lst.del("value_" + std::to_string(i));
+    for (int i = 0; i < 500; ++i) lst.insert_after("value_" + std::to_string(i * 3 + 1), "n" + std::to_string(i));
+    std::string before = dump(lst);
+
+    EXPECT_GT(lst.compact(), 0u);
+    EXPECT_EQ(dump(lst), before);
+    const char* prev = reinterpret_cast<const char*>(&*lst.begin());
+    for (auto it = ++lst.begin(); it != lst.end(); ++it) {
+        const char* cur = reinterpret_cast<const char*>(&*it);
+        EXPECT_GT(cur, prev);
+        ASSERT_LT(cur - prev, 64); // соседние узлы подряд
+        prev = cur;
+    }
+    // Повторная дефрагментация без изменений ничего не освобождает
+    EXPECT_EQ(lst.compact(), 0u);
+
+    // Дальнейшие правки смешивают узлы из блока и отдельные узлы
+    lst.push_front("front");
+    lst.del("value_1");
+    lst.del_tail();
+    lst.del_head();
+    lst.del_after("value_2");
+    lst.del_before("value_5");
+    lst.sort();
+    List other;
+    other.push_back("z");
+    lst.split_at(100, other);
+    other.concat(lst);
+    EXPECT_TRUE(lst.is_empty());
+    other.compact();
+    EXPECT_EQ(other.find("front"), nullptr);
+    EXPECT_EQ(other.get_at(0)->data, "z");
+}
+
+// Дефрагментированный список со статическим временем жизни разрушается
+// после main: учёт блоков не должен зависеть от других статических объектов
+static List compacted_at_exit;
+
+// Узлы одного блока после splice живут в разных списках, которые
+// разрушаются в любом порядке и освобождают узлы из разных потоков
+TEST(ListTest, CompactSlabSharedAcrossLists) {
+    for (int i = 0; i < 50; ++i) compacted_at_exit.push_back(std::to_string(i));
+    compacted_at_exit.compact();
+    compacted_at_exit.del("10");
+
+    for (int round = 0; round < 20; ++round) {
+        List* a = new List;
+        List* b = new List;
+        for (int i = 0; i < 2000; ++i) a->push_back(std::to_string(i));
+        a->compact();
+        a->split_at(1000, *b);
+        List c;
+        c.concat(*a);
+        a->push_back("fresh");
+        std::thread t1([b] {
+            while (!b->is_empty()) b->del_head();
+        });
+        std::thread t2([&c] {
+            while (!c.is_empty()) c.del_tail();
+        });
+        t1.join();
+        t2.join();
+        if (round % 2) {
+            delete a;
+            delete b;
+        } else {
+            delete b;
+            delete a;
+        }
+    }
+    EXPECT_EQ(compacted_at_exit.get_size(), 49);
+}
+
+TEST(ListTest, CompactRebuildsIndex) {
+    List lst;
+    lst.enable_index();
+    for (int i = 0; i < 100; ++i) lst.push_back(std::to_string(i % 10));
+    lst.compact();
+    EXPECT_EQ(lst.find("7"), lst.get_at(7));
+    lst.del("7");
+    EXPECT_EQ(lst.find("7"), lst.get_at(16));
+    lst.del_before("8");
+    EXPECT_EQ(lst.get_at(6)->data, "8");
+}
+
+// ===== KEY INDEX =====
+
+TEST(ListIndexTest, MatchesUnindexedUnderRandomEdits) {
+    List plain, fast;
+    fast.enable_index();
+    EXPECT_TRUE(fast.is_indexed());
+    std::mt19937 rng(7);
+    // Малый алфавит ключей даёт много дубликатов
+    auto key = [&] { return "k" + std::to_string(rng() % 12); };
+    std::stringstream sink;
+    std::streambuf* old = std::cout.rdbuf(sink.rdbuf());
+    for (int step = 0; step < 4000; ++step) {
+        std::string a = key(), b = key();
+        int pos = static_cast<int>(rng() % 16);
+        switch (rng() % 11) {
+        case 0: plain.push_back(a); fast.push_back(a); break;
+        case 1: plain.push_front(a); fast.push_front(a); break;
+        case 2: plain.insert_after(a, b); fast.insert_after(a, b); break;
+        case 3: plain.insert_before(a, b); fast.insert_before(a, b); break;
+        case 4: plain.del(a); fast.del(a); break;
+        case 5: plain.del_after(a); fast.del_after(a); break;
+        case 6: plain.del_before(a); fast.del_before(a); break;
+        case 7: plain.del_head(); fast.del_head(); break;
+        case 8: plain.del_tail(); fast.del_tail(); break;
+        case 9: plain.replace_at(pos, b); fast.replace_at(pos, b); break;
+        default:
+            EXPECT_EQ(plain.find(a) == nullptr, fast.find(a) == nullptr);
+            if (fast.find(a)) {
+                // find возвращает первое вхождение
+                int i = 0;
+                while (fast.get_at(i)->data != a) ++i;
+                EXPECT_EQ(fast.find(a), fast.get_at(i));
+            }
+        }
+        ASSERT_EQ(dump(plain), dump(fast)) << "step " << step;
+    }
+    std::cout.rdbuf(old);
+}
+
+TEST(ListIndexTest, DuplicatesAddressFirstOccurrence) {
+    List lst;
+    lst.enable_index();
+    lst.push_back("a");
+    lst.push_back("x");
+    lst.push_back("a");
+    lst.insert_after("x", "b");
+    lst.insert_before("x", "a"); // a a x b a
+    EXPECT_EQ(lst.find("a"), lst.get_at(0));
+    lst.del("a");                // удаляет голову
+    EXPECT_EQ(lst.find("a"), lst.get_at(0));
+    lst.del("a");                // x b a
+    EXPECT_EQ(lst.find("a"), lst.get_at(2));
+    lst.del_before("a");         // удаляет "b"
+    EXPECT_EQ(dump(lst), "2\nx\na\n");
+    lst.del("a");
+    EXPECT_EQ(lst.find("a"), nullptr);
+}
+
+// Смена значения идёт через replace_at, который правит и индекс
+TEST(ListIndexTest, ReplaceAtRekeysEntry) {
+    List lst;
+    lst.enable_index();
+    lst.push_back("b");
+    lst.push_back("b");
+    lst.del("b");
+    lst.replace_at(0, "y");
+    EXPECT_EQ(lst.find("b"), nullptr);
+    EXPECT_EQ(lst.find("y"), lst.get_at(0));
+
+    lst.push_back("b");
+    lst.push_back("b"); // y b b
+    lst.replace_at(1, "x");
+    EXPECT_EQ(lst.find("b"), lst.get_at(2));
+    EXPECT_EQ(lst.find("x"), lst.get_at(1));
+    lst.replace_at(0, "b"); // b x b
+    EXPECT_EQ(lst.find("b"), lst.get_at(0));
+    lst.del("b");
+    EXPECT_EQ(lst.find("b"), lst.get_at(1));
+    lst.replace_at(5, "none");
+    lst.replace_at(-1, "none");
+    EXPECT_EQ(dump(lst), "2\nx\nb\n");
+}
+
+TEST(ListIndexTest, EnableAfterFillAndDeserialize) {
+    List lst;
+    for (int i = 0; i < 50; ++i) lst.push_back(std::to_string(i));
+    EXPECT_EQ(lst.index_memory_usage(), 0u);
+    lst.enable_index();
+    EXPECT_EQ(lst.find("30"), lst.get_at(30));
+    EXPECT_GT(lst.index_memory_usage(), 50 * sizeof(std::string));
+
+    std::stringstream ss("3\nq\nw\ne\n");
+    lst.deserialize(ss);
+    EXPECT_TRUE(lst.is_indexed());
+    EXPECT_EQ(lst.find("30"), nullptr);
+    EXPECT_EQ(lst.find("w"), lst.get_at(1));
+    lst.del_before("e");
+    EXPECT_EQ(dump(lst), "2\nq\ne\n");
+
+    lst.disable_index();
+    EXPECT_FALSE(lst.is_indexed());
+    EXPECT_EQ(lst.find("e"), lst.get_at(1));
+}
+
+// ===== UNROLLED LIST =====
+TEST(UnrolledListTest, EmptyList) {
+    UnrolledList lst;
+    EXPECT_TRUE(lst.is_empty());
+    EXPECT_EQ(lst.get_size(), 0);
+    EXPECT_EQ(lst.get_at(0), nullptr);
+    EXPECT_EQ(lst.find("a"), nullptr);
+}
+
+TEST(UnrolledListTest, MatchesListAcrossNodeBoundaries) {
+    List ref;
+    UnrolledList lst;
+    for (int i = 0; i < 100; ++i) {
+        ref.push_back("v" + std::to_string(i));
+        lst.push_back("v" + std::to_string(i));
+    }
+    ref.push_front("f");
+    lst.push_front("f");
+    ref.insert_after("v15", "a15");
+    lst.insert_after("v15", "a15");
+    ref.insert_before("v16", "b16");
+    lst.insert_before("v16", "b16");
+    for (int i = 0; i < 100; i += 3) {
+        ref.del("v" + std::to_string(i));
+        lst.del("v" + std::to_string(i));
+    }
+    ref.del_after("v31");
+    lst.del_after("v31");
+    ref.del_before("v50");
+    lst.del_before("v50");
+    ref.del_head();
+    lst.del_head();
+    ref.del_tail();
+    lst.del_tail();
+
+    ASSERT_EQ(lst.get_size(), ref.get_size());
+    for (int i = 0; i < ref.get_size(); ++i)
+        EXPECT_EQ(*lst.get_at(i), ref.get_at(i)->data) << "index " << i;
+    EXPECT_EQ(lst.get_at(lst.get_size()), nullptr);
+}
+
+TEST(UnrolledListTest, DelBeforeAtNodeStart) {
+    UnrolledList lst;
+    for (int i = 0; i < UnrolledList::NODE_CAPACITY + 1; ++i)
+        lst.push_back(std::to_string(i));
+    EXPECT_EQ(lst.get_node_count(), 2);
+    // Первый элемент второго узла: удаляется последний элемент первого
+    lst.del_before(std::to_string(UnrolledList::NODE_CAPACITY));
+    EXPECT_EQ(lst.get_size(), UnrolledList::NODE_CAPACITY);
+    EXPECT_EQ(lst.find(std::to_string(UnrolledList::NODE_CAPACITY - 1)), nullptr);
+    lst.del_after(std::to_string(UnrolledList::NODE_CAPACITY - 2));
+    EXPECT_EQ(*lst.get_at(UnrolledList::NODE_CAPACITY - 2),
+              std::to_string(UnrolledList::NODE_CAPACITY - 2));
+    EXPECT_EQ(lst.get_size(), UnrolledList::NODE_CAPACITY - 1);
+}
+
+TEST(UnrolledListTest, SequentialAppendFillsNodes) {
+    UnrolledList lst;
+    for (int i = 0; i < 10 * UnrolledList::NODE_CAPACITY; ++i)
+        lst.push_back("x");
+    EXPECT_EQ(lst.get_node_count(), 10);
+    for (int i = 0; i < 10 * UnrolledList::NODE_CAPACITY; ++i)
+        lst.del_head();
+    EXPECT_TRUE(lst.is_empty());
+    EXPECT_EQ(lst.get_node_count(), 0);
+    lst.push_back("again");
+    EXPECT_EQ(*lst.get_at(0), "again");
+}
+
+TEST(UnrolledListTest, MissingKeys) {
+    UnrolledList lst;
+    lst.push_back("a");
+    std::stringstream ss;
+    std::streambuf* old = std::cout.rdbuf(ss.rdbuf());
+    lst.insert_after("zz", "b");
+    lst.del("zz");
+    lst.print();
+    std::cout.rdbuf(old);
+    EXPECT_EQ(ss.str(), "Элемент 'zz' не найден.\nЭлемент 'zz' не найден.\na \n");
+    lst.del_before("a");
+    lst.del_after("a");
+    EXPECT_EQ(lst.get_size(), 1);
+}
+
+TEST(UnrolledListTest, SerializationCompatibleWithList) {
+    List ref;
+    ref.push_back("hello world");
+    ref.push_back("");
+    for (int i = 0; i < 40; ++i) ref.push_back(std::to_string(i));
+    std::stringstream ss;
+    ref.serialize(ss);
+
+    UnrolledList lst;
+    lst.push_back("stale");
+    lst.deserialize(ss);
+    ASSERT_EQ(lst.get_size(), 42);
+    EXPECT_EQ(*lst.get_at(0), "hello world");
+    EXPECT_EQ(*lst.get_at(1), "");
+    EXPECT_EQ(*lst.get_at(41), "39");
+
+    std::stringstream back;
+    lst.serialize(back);
+    List ref2;
+    ref2.deserialize(back);
+    ASSERT_EQ(ref2.get_size(), 42);
+    EXPECT_EQ(ref2.get_at(41)->data, "39");
+}
+
 // ===== BENCHMARKS =====
 TEST(ListBench, BENCHMARK_List_PushBack) {
     auto start = std::chrono::high_resolution_clock::now();
@@ -224,4 +744,158 @@ TEST(ListBench, BENCHMARK_List_Find) {
     auto end = std::chrono::high_resolution_clock::now();
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
     std::cout << "\nfind x50000: " << ms << " ms\n";
-}
\ No newline at end of file
+}
+TEST(ListBench, BENCHMARK_UnrolledList_TraversalAndMemory) {
+    const int N = 1000000;
+    List l;
+    UnrolledList u;
+    for (int i = 0; i < N; ++i) {
+        std::string v = "elem_" + std::to_string(i);
+        l.push_back(v);
+        u.push_back(v);
+    }
+    // Полный обход через find отсутствующего ключа
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < 5; ++r) EXPECT_EQ(l.find("missing"), nullptr);
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < 5; ++r) EXPECT_EQ(u.find("missing"), nullptr);
+    auto end = std::chrono::high_resolution_clock::now();
+    auto list_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto unrolled_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count();
+    // Узел List: строка + указатель + служебный заголовок malloc (~16 байт)
+    std::size_t list_bytes = static_cast<std::size_t>(N) * (sizeof(std::string) + sizeof(void*) + 16);
+    std::size_t unrolled_bytes = u.memory_usage() + u.get_node_count() * 16;
+    std::cout << "\nfull scan x5 (1M): List " << list_ms << " ms, UnrolledList "
+              << unrolled_ms << " ms\n"
+              << "node memory: List ~" << list_bytes / 1024 << " KiB, UnrolledList ~"
+              << unrolled_bytes / 1024 << " KiB (" << u.get_node_count() << " nodes)\n";
+    EXPECT_LT(unrolled_bytes, list_bytes);
+}
+
+TEST(ListBench, BENCHMARK_List_IndexedKeyEdits) {
+    const int N = 20000;
+    List plain, fast;
+    fast.enable_index();
+    for (int i = 0; i < N; ++i) {
+        plain.push_back("elem_" + std::to_string(i));
+        fast.push_back("elem_" + std::to_string(i));
+    }
+    auto run = [&](List& l) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = N - 1; i > 0; i -= 2) {
+            std::string k = "elem_" + std::to_string(i);
+            l.insert_before(k, k + "_b");
+            l.del_after(k);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    };
+    auto plain_ms = run(plain);
+    auto fast_ms = run(fast);
+    EXPECT_EQ(dump(plain), dump(fast));
+    std::cout << "\ninsert_before+del_after x" << N / 2 << ": plain " << plain_ms
+              << " ms, indexed " << fast_ms << " ms; index ~"
+              << fast.index_memory_usage() / 1024 << " KiB for " << fast.get_size()
+              << " keys\n";
+}
+
+TEST(ListBench, BENCHMARK_List_SpliceVsCopy) {
+    const int N = 200000, CHUNK = 1000;
+    List src, dst, src2, dst2;
+    for (int i = 0; i < N; ++i) {
+        src.push_back("record_payload_" + std::to_string(i));
+        src2.push_back("record_payload_" + std::to_string(i));
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    // Копированием: push_back копии и удаление из источника
+    for (int i = 0; i < N; ++i) {
+        dst.push_back(src.get_at(0)->data);
+        src.del_head();
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    // Перевязкой: кусками по CHUNK через split_at + concat
+    while (!src2.is_empty()) {
+        List rest;
+        src2.split_at(CHUNK, rest); // в src2 остаются первые CHUNK
+        dst2.concat(src2);
+        src2.concat(rest);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto copy_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto splice_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count();
+    std::cout << "\nmove 200k records: copy " << copy_ms << " ms, splice " << splice_ms << " ms\n";
+    EXPECT_EQ(dst2.get_at(N - 1)->data, dst.get_at(N - 1)->data);
+}
+
+TEST(ListBench, BENCHMARK_List_IndexLoopVsIterator) {
+    const int N = 20000;
+    List l;
+    for (int i = 0; i < N; ++i) l.push_back("elem_" + std::to_string(i));
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t by_index = 0;
+    for (int i = 0; i < N; ++i) by_index += l.get_at(i)->data.size();
+    auto mid = std::chrono::high_resolution_clock::now();
+    size_t by_iter = 0;
+    for (const std::string& s : l) by_iter += s.size();
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(by_index, by_iter);
+    auto index_us = std::chrono::duration_cast<std::chrono::microseconds>(mid - start).count();
+    auto iter_us = std::chrono::duration_cast<std::chrono::microseconds>(end - mid).count();
+    std::cout << "\ntraverse 20k: get_at loop " << index_us << " us, iterator " << iter_us << " us\n";
+}
+
+TEST(ListBench, BENCHMARK_List_SelfOrganizingFind) {
+    const int KEYS = 2000, LOOKUPS = 200000;
+    std::vector<double> weights(KEYS);
+    for (int k = 0; k < KEYS; ++k) weights[k] = 1.0 / (k + 1);
+    std::discrete_distribution<int> zipf(weights.begin(), weights.end());
+    std::uniform_int_distribution<int> uniform(0, KEYS - 1);
+    std::mt19937 rng(8);
+    // Частые ключи разбросаны по списку, а не стоят в начале
+    std::vector<int> perm(KEYS);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), rng);
+    std::vector<int> uni_trace(LOOKUPS), zipf_trace(LOOKUPS);
+    for (int& t : uni_trace) t = uniform(rng);
+    for (int& t : zipf_trace) t = perm[zipf(rng)];
+
+    std::cout << "\n";
+    for (auto mode : {List::FindMode::Plain, List::FindMode::MoveToFront, List::FindMode::Transpose}) {
+        const char* name = mode == List::FindMode::Plain ? "plain"
+                         : mode == List::FindMode::MoveToFront ? "move-to-front" : "transpose";
+        for (int w = 0; w < 2; ++w) {
+            List l;
+            for (int k = 0; k < KEYS; ++k) l.push_back("key_" + std::to_string(k));
+            l.set_find_mode(mode);
+            const std::vector<int>& trace = w ? zipf_trace : uni_trace;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int t : trace) EXPECT_NE(l.find("key_" + std::to_string(t)), nullptr);
+            auto end = std::chrono::high_resolution_clock::now();
+            std::cout << name << (w ? " zipf: " : " uniform: ")
+                      << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                      << " ms\n";
+        }
+    }
+}
+
+TEST(ListBench, BENCHMARK_List_CompactTraversal) {
+    const int N = 500000;
+    std::mt19937 rng(4);
+    List l;
+    // Узлы выделяются подряд, но после сортировки случайных ключей порядок
+    // обхода не совпадает с порядком в памяти, как после долгой работы
+    for (int i = 0; i < N; ++i) l.push_back("k" + std::to_string(rng()));
+    for (int i = 0; i < N; i += 2) l.push_back("long_value_outside_sso_" + std::to_string(i));
+    l.sort();
+    auto scan = [&] {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < 5; ++r) EXPECT_EQ(l.find("missing"), nullptr);
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    };
+    auto before_ms = scan();
+    size_t freed = l.compact();
+    auto after_ms = scan();
+    std::cout << "\nfull scan x5 (" << l.get_size() << " nodes): scattered " << before_ms
+              << " ms, compacted " << after_ms << " ms, freed ~" << freed / 1024 << " KiB\n";
+}
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 #include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
 #include "../../sd/array/array.hpp"
+#include "../../sd/array/mass_view.hpp"
 #include "../../sd/list/list.hpp"
 #include "../../sd/stack/stack.hpp"
 #include "../../sd/queue/queue.hpp"
@@ -47,6 +53,158 @@ TEST_F(ArraySerializationTest, BinarySerializationEmpty)
     EXPECT_TRUE(restored.is_empty());
 }
 
+class MassViewTest : public ::testing::Test {
+protected:
+    std::string path = testing::TempDir() + "mass_view_test.bin";
+
+    void TearDown() override { std::remove(path.c_str()); }
+
+    void write(const Mass &m, bool indexed) {
+        std::ofstream out(path, std::ios::binary);
+        if (indexed) m.serialize_indexed(out);
+        else m.serialize(out);
+    }
+};
+
+TEST_F(MassViewTest, IndexedSnapshot)
+{
+    Mass original;
+    original.push_back("hello");
+    original.push_back("");
+    original.push_back(std::string(5000, 'w'));
+    write(original, true);
+
+    MassView view;
+    ASSERT_TRUE(view.open(path));
+    EXPECT_TRUE(view.is_indexed());
+    ASSERT_EQ(view.get_size(), 3);
+    EXPECT_EQ(view.get_at(0), "hello");
+    EXPECT_EQ(view.get_at(1), "");
+    EXPECT_EQ(view.get_at(2), std::string(5000, 'w'));
+    EXPECT_EQ(view.get_at(3), "");
+    EXPECT_EQ(view.get_at(-1), "");
+
+    std::string joined;
+    for (std::string_view v : view) joined += v.substr(0, 1);
+    EXPECT_EQ(joined, "hw");
+    EXPECT_EQ(view.end() - view.begin(), 3);
+}
+
+TEST_F(MassViewTest, PlainSnapshotIsScanned)
+{
+    Mass original;
+    for (int i = 0; i < 100; ++i) original.push_back("v" + std::to_string(i));
+    write(original, false);
+
+    MassView view;
+    ASSERT_TRUE(view.open(path));
+    EXPECT_FALSE(view.is_indexed());
+    ASSERT_EQ(view.get_size(), 100);
+    EXPECT_EQ(view.get_at(57), "v57");
+    view.close();
+    EXPECT_FALSE(view.is_open());
+    EXPECT_TRUE(view.is_empty());
+}
+
+TEST_F(MassViewTest, IndexedSnapshotReadableByDeserialize)
+{
+    Mass original;
+    original.push_back("a");
+    original.push_back("b");
+    std::ostringstream oss;
+    original.serialize_indexed(oss);
+
+    std::istringstream iss(oss.str());
+    Mass restored;
+    restored.deserialize(iss);
+    ASSERT_EQ(restored.get_size(), 2);
+    EXPECT_EQ(restored.get_at(1), "b");
+}
+
+// Испорченная таблица смещений: открытие O(1) её не проверяет, get_at —
+// проверяет
+TEST_F(MassViewTest, CorruptIndexEntryGivesEmptyView)
+{
+    Mass original;
+    for (const char *v : {"zero", "one", "two", "three", "four"}) original.push_back(v);
+    std::ostringstream oss;
+    original.serialize_indexed(oss);
+    std::string bytes = oss.str();
+    const size_t trailer = sizeof(std::int64_t) + sizeof(MASS_INDEX_MAGIC);
+    std::int64_t table = 0;
+    std::memcpy(&table, bytes.data() + bytes.size() - trailer, sizeof(table));
+
+    auto patch = [&](int entry, std::int64_t value) {
+        std::string copy = bytes;
+        std::memcpy(&copy[table + entry * sizeof(std::int64_t)], &value, sizeof(value));
+        std::ofstream(path, std::ios::binary) << copy;
+    };
+
+    MassView view;
+    patch(3, std::int64_t(1) << 40);
+    ASSERT_TRUE(view.open(path));
+    EXPECT_TRUE(view.is_indexed());
+    EXPECT_EQ(view.get_at(3), "");
+    EXPECT_EQ(view.get_at(2), "two");
+
+    patch(1, -8);
+    ASSERT_TRUE(view.open(path));
+    EXPECT_EQ(view.get_at(1), "");
+
+    patch(4, table - 2); // префикс длины залезает в таблицу
+    ASSERT_TRUE(view.open(path));
+    EXPECT_EQ(view.get_at(4), "");
+    EXPECT_EQ(view.get_at(0), "zero");
+}
+
+TEST_F(MassViewTest, RejectsMissingAndTruncatedFiles)
+{
+    MassView view;
+    EXPECT_FALSE(view.open(path + ".missing"));
+
+    {
+        std::ofstream out(path, std::ios::binary);
+        int size = 10;
+        int len = 100;
+        out.write(reinterpret_cast<const char *>(&size), sizeof(int));
+        out.write(reinterpret_cast<const char *>(&len), sizeof(int));
+        out << "short";
+    }
+    EXPECT_FALSE(view.open(path));
+    EXPECT_FALSE(view.is_open());
+}
+
+TEST(MassViewBench, BENCHMARK_MassView_OpenVsDeserialize)
+{
+    std::string path = testing::TempDir() + "mass_view_bench.bin";
+    const int N = 1000000;
+    {
+        Mass m;
+        for (int i = 0; i < N; ++i) m.push_back("record_" + std::to_string(i));
+        std::ofstream out(path, std::ios::binary);
+        m.serialize_indexed(out);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    Mass loaded;
+    {
+        std::ifstream in(path, std::ios::binary);
+        loaded.deserialize(in);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    MassView view;
+    bool opened = view.open(path);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto load_ms = std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count();
+    auto open_us = std::chrono::duration_cast<std::chrono::microseconds>(end - mid).count();
+    std::cout << "\ndeserialize x" << N << ": " << load_ms << " ms, MassView::open: " << open_us << " us\n";
+    EXPECT_TRUE(opened);
+    EXPECT_EQ(view.get_at(N - 1), loaded.get_at(N - 1));
+    view.close();
+    std::remove(path.c_str());
+}
+
 class HashTableSerializationTest : public ::testing::Test {};
 
 TEST_F(HashTableSerializationTest, BinarySerializationWithData)
@@ -1,8 +1,17 @@
 #include "gtest/gtest.h"
 #include "../sd/stack/stack.hpp"
+#include "../sd/stack/block_stack.hpp"
+#include "../sd/stack/concurrent_stack.hpp"
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <mutex>
+#include <random>
 #include <sstream>
 #include <string>
 #include <chrono>
+#include <thread>
+#include <vector>
 
 // Вспомогательная функция для перехвата вывода print()
 std::string capturePrint(const Stack& s) {
@@ -78,6 +87,195 @@ TEST(StackTest, StressTest) {
     EXPECT_TRUE(s.is_empty());
 }
 
+TEST(StackTest, PopValueAndTryPop) {
+    Stack s;
+    std::string out = "keep";
+    EXPECT_FALSE(s.try_pop(out));
+    EXPECT_EQ(out, "keep");
+    std::stringstream ss;
+    std::streambuf* old = std::cout.rdbuf(ss.rdbuf());
+    EXPECT_EQ(s.pop_value(), "");
+    std::cout.rdbuf(old);
+    EXPECT_EQ(ss.str(), "Стек пуст!\n");
+
+    s.push("a");
+    std::string big(1000, 'b');
+    s.push(std::move(big));
+    EXPECT_EQ(s.pop_value(), std::string(1000, 'b'));
+    EXPECT_TRUE(s.try_pop(out));
+    EXPECT_EQ(out, "a");
+    EXPECT_TRUE(s.is_empty());
+}
+
+TEST(StackTest, PushRangeAndPopN) {
+    Stack s;
+    std::vector<std::string> items = {"1", "2", "3", "4", "5"};
+    s.push_range(items.begin(), items.end());
+    EXPECT_EQ(capturePrint(s), "5 4 3 2 1 \n");
+    s.push_range(std::make_move_iterator(items.begin()), std::make_move_iterator(items.begin() + 2));
+    EXPECT_EQ(s.top(), "2");
+
+    std::vector<std::string> out = {"x"};
+    EXPECT_EQ(s.pop_n(3, out), 3u);
+    EXPECT_EQ(out, (std::vector<std::string>{"x", "2", "1", "5"}));
+    EXPECT_EQ(s.pop_n(10, out), 4u);
+    EXPECT_EQ(out.back(), "1");
+    EXPECT_EQ(s.pop_n(1, out), 0u);
+    EXPECT_TRUE(s.is_empty());
+}
+
+TEST(StackTest, DeserializeKeepsOrder) {
+    Stack s;
+    for (int i = 0; i < 5; ++i) s.push(std::to_string(i));
+    std::stringstream ss;
+    s.serialize(ss);
+    Stack copy;
+    copy.push("old");
+    copy.deserialize(ss);
+    EXPECT_EQ(capturePrint(copy), "4 3 2 1 0 \n");
+    std::stringstream empty("0\n");
+    copy.deserialize(empty);
+    EXPECT_TRUE(copy.is_empty());
+}
+
+// ===== BLOCK STACK =====
+static std::string dump(const Stack& s) {
+    std::stringstream ss;
+    s.serialize(ss);
+    return ss.str();
+}
+
+static std::string dump(const BlockStack& s) {
+    std::stringstream ss;
+    s.serialize(ss);
+    return ss.str();
+}
+
+// Случайные push/pop через границы блоков: поведение как у Stack
+TEST(BlockStackTest, MatchesStack) {
+    Stack ref;
+    BlockStack s;
+    std::mt19937 rng(3);
+    std::stringstream sink;
+    std::streambuf* old = std::cout.rdbuf(sink.rdbuf());
+    for (int step = 0; step < 5000; ++step) {
+        if (rng() % 5 < 3) {
+            std::string val = std::string(rng() % 40, 'x') + std::to_string(step);
+            ref.push(val);
+            s.push(val);
+        } else {
+            ref.pop();
+            s.pop();
+        }
+        ASSERT_EQ(s.top(), ref.top());
+    }
+    std::cout.rdbuf(old);
+    EXPECT_EQ(dump(s), dump(ref));
+    EXPECT_GT(s.get_size(), 64);
+}
+
+TEST(BlockStackTest, PrintAndEmpty) {
+    BlockStack s;
+    EXPECT_TRUE(s.is_empty());
+    EXPECT_EQ(s.top(), "");
+    for (int i = 0; i < 130; ++i) s.push(std::to_string(i));
+    std::string out;
+    for (int i = 129; i >= 0; --i) out += std::to_string(i) + " ";
+    std::stringstream ss;
+    std::streambuf* old = std::cout.rdbuf(ss.rdbuf());
+    s.print();
+    std::cout.rdbuf(old);
+    EXPECT_EQ(ss.str(), out + "\n");
+    size_t full = s.memory_usage();
+    for (int i = 0; i < 130; ++i) s.pop();
+    EXPECT_TRUE(s.is_empty());
+    EXPECT_EQ(s.get_size(), 0);
+    EXPECT_EQ(s.memory_usage(), full); // блоки остаются в запасе
+    s.push("again");
+    s.shrink_to_fit();
+    EXPECT_LT(s.memory_usage(), full);
+    EXPECT_EQ(s.top(), "again");
+    s.pop();
+    s.shrink_to_fit();
+    EXPECT_EQ(s.memory_usage(), sizeof(BlockStack));
+    s.push("after shrink");
+    EXPECT_EQ(s.top(), "after shrink");
+}
+
+TEST(BlockStackTest, SerializeRoundTrip) {
+    for (int n : {0, 1, 64, 65, 200}) {
+        Stack ref;
+        for (int i = 0; i < n; ++i) ref.push("item " + std::to_string(i));
+        BlockStack s;
+        s.push("stale");
+        std::stringstream in(dump(ref));
+        s.deserialize(in);
+        EXPECT_EQ(s.get_size(), n);
+        EXPECT_EQ(dump(s), dump(ref));
+        if (n) {
+            EXPECT_EQ(s.top(), "item " + std::to_string(n - 1));
+        }
+    }
+}
+
+// ===== CONCURRENT STACK =====
+TEST(ConcurrentStackTest, SingleThreadLIFO) {
+    ConcurrentStack s;
+    std::string out;
+    EXPECT_TRUE(s.is_empty());
+    EXPECT_FALSE(s.pop(out));
+    for (int i = 0; i < 1000; ++i) s.push(std::to_string(i));
+    EXPECT_EQ(s.get_size(), 1000);
+    for (int i = 999; i >= 500; --i) {
+        ASSERT_TRUE(s.pop(out));
+        EXPECT_EQ(out, std::to_string(i));
+    }
+    // Освободившиеся узлы переиспользуются
+    s.push(std::string(100, 'x'));
+    ASSERT_TRUE(s.pop(out));
+    EXPECT_EQ(out, std::string(100, 'x'));
+    ASSERT_TRUE(s.pop(out));
+    EXPECT_EQ(out, "499");
+    EXPECT_EQ(s.get_size(), 499);
+    EXPECT_EQ(s.eliminated(), 0u);
+}
+
+// Производители и потребители: каждый элемент снимается ровно один раз
+TEST(ConcurrentStackTest, ProducersConsumersKeepEveryElement) {
+    const int THREADS = 4, PER_THREAD = 20000;
+    ConcurrentStack s;
+    std::vector<std::vector<int>> taken(THREADS);
+    std::atomic<int> remaining{THREADS * PER_THREAD};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                s.push(std::to_string(t * PER_THREAD + i));
+                std::string out;
+                if (i % 2 && s.pop(out)) {
+                    taken[t].push_back(std::stoi(out));
+                    remaining.fetch_sub(1);
+                }
+            }
+            std::string out;
+            while (remaining.load() > 0) {
+                if (s.pop(out)) {
+                    taken[t].push_back(std::stoi(out));
+                    remaining.fetch_sub(1);
+                }
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+    std::vector<int> all;
+    for (auto& v : taken) all.insert(all.end(), v.begin(), v.end());
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), static_cast<size_t>(THREADS * PER_THREAD));
+    for (int i = 0; i < THREADS * PER_THREAD; ++i) ASSERT_EQ(all[i], i);
+    EXPECT_TRUE(s.is_empty());
+    EXPECT_EQ(s.get_size(), 0);
+}
+
 // ===== BENCHMARKS =====
 TEST(StackBench, BENCHMARK_Stack_Push) {
     auto start = std::chrono::high_resolution_clock::now();
@@ -96,4 +294,99 @@ TEST(StackBench, BENCHMARK_Stack_PushPop) {
     auto end = std::chrono::high_resolution_clock::now();
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
     std::cout << "\npush/pop x5000: " << ms << " ms\n";
-}
\ No newline at end of file
+}
+
+TEST(StackBench, BENCHMARK_BlockStack_VsStack) {
+    const int DEPTH = 1000, ROUNDS = 2000;
+    const std::string val(48, 'v'); // длиннее SSO-буфера: у Stack ещё и выделение строки
+    auto churn = [&](auto& s) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < ROUNDS; ++r) {
+            for (int i = 0; i < DEPTH; ++i) s.push(val);
+            for (int i = 0; i < DEPTH; ++i) s.pop();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    };
+    Stack list_stack;
+    BlockStack block_stack;
+    auto list_ms = churn(list_stack);
+    auto block_ms = churn(block_stack);
+    EXPECT_TRUE(block_stack.is_empty());
+    std::cout << "\n" << ROUNDS << " x (push " << DEPTH << " + pop " << DEPTH << "): Stack "
+              << list_ms << " ms, BlockStack " << block_ms << " ms\n";
+}
+
+TEST(StackBench, BENCHMARK_ConcurrentStack_Threads) {
+    const int OPS = 400000; // пар push/pop на все потоки
+    for (int threads : {1, 2, 4, 8, 16}) {
+        ConcurrentStack lock_free;
+        Stack locked;
+        std::mutex locked_mutex;
+        auto run = [&](auto&& pair) {
+            std::vector<std::thread> workers;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int t = 0; t < threads; ++t) {
+                workers.emplace_back([&] {
+                    std::string out;
+                    for (int i = 0; i < OPS / threads; ++i) pair(out);
+                });
+            }
+            for (auto& w : workers) w.join();
+            auto end = std::chrono::high_resolution_clock::now();
+            return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        };
+        auto free_us = run([&](std::string& out) {
+            lock_free.push("v");
+            lock_free.pop(out);
+        });
+        auto locked_us = run([&](std::string& out) {
+            {
+                std::lock_guard<std::mutex> g(locked_mutex);
+                locked.push("v");
+            }
+            std::lock_guard<std::mutex> g(locked_mutex);
+            if (!locked.is_empty()) {
+                out = locked.top();
+                locked.pop();
+            }
+        });
+        std::cout << "\n" << threads << " threads: lock-free " << OPS * 1000000LL / (free_us + 1)
+                  << " pairs/s (eliminated " << lock_free.eliminated() << "), mutex Stack "
+                  << OPS * 1000000LL / (locked_us + 1) << " pairs/s";
+        EXPECT_TRUE(lock_free.is_empty());
+    }
+    std::cout << "\n";
+}
+
+TEST(StackBench, BENCHMARK_Stack_DrainTopPopVsPopValue) {
+    const int N = 20000;
+    const std::string big(4096, 's');
+    Stack by_copy, by_move, by_batch;
+    for (int i = 0; i < N; ++i) {
+        by_copy.push(big);
+        by_move.push(big);
+        by_batch.push(big);
+    }
+    size_t bytes = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    while (!by_copy.is_empty()) {
+        bytes += by_copy.top().size();
+        by_copy.pop();
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    std::string out;
+    while (by_move.try_pop(out)) bytes += out.size();
+    auto mid2 = std::chrono::high_resolution_clock::now();
+    std::vector<std::string> batch;
+    batch.reserve(N);
+    by_batch.pop_n(N, batch);
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(bytes, 2u * N * big.size());
+    EXPECT_EQ(batch.size(), static_cast<size_t>(N));
+    auto us = [](auto a, auto b) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count();
+    };
+    std::cout << "\ndrain 20000 x 4 KiB: top+pop " << us(start, mid) << " us, try_pop "
+              << us(mid, mid2) << " us, pop_n " << us(mid2, end) << " us\n";
+}